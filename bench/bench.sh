@@ -0,0 +1,43 @@
+#!/bin/bash
+# Builds each benchmark with optimizations and reports wall-clock run time.
+# Usage: bench/bench.sh [bench/file.rox ...]   (defaults to every bench/*.rox)
+# Set N to override the problem size of benchmarks that mark it with `// bench-size`.
+# A `// bench-input: <script>` line names a generator whose output is fed to stdin.
+
+cd "$(dirname "$0")/.."
+
+CXX=${CXX:-clang++}
+CXXFLAGS=${CXXFLAGS:--O2}
+
+make -s || exit 1
+mkdir -p generated
+
+files=("$@")
+if [ ${#files[@]} -eq 0 ]; then
+    files=(bench/*.rox)
+fi
+
+echo "Running ROX Benchmarks ($CXX $CXXFLAGS)..."
+echo "--------------------------------"
+
+for file in "${files[@]}"; do
+    name=$(basename "$file" .rox)
+    if [ -n "$N" ]; then
+        mkdir -p generated/bench
+        sed "s#= [0-9]*; // bench-size#= $N; // bench-size#" "$file" > "generated/bench/$name.rox"
+        file="generated/bench/$name.rox"
+    fi
+    ./rox generate "$file" > /dev/null || exit 1
+    $CXX -w -std=c++20 -pthread $CXXFLAGS -o "generated/$name" "generated/$name.cc" || exit 1
+
+    input=/dev/null
+    generator=$(sed -n 's#^// bench-input: ##p' "$file")
+    if [ -n "$generator" ]; then
+        input="generated/$name.in"
+        bash "$generator" > "$input" || exit 1
+    fi
+
+    TIMEFORMAT="%R"
+    seconds=$( { time "./generated/$name" < "$input" > /dev/null; } 2>&1 )
+    printf "%-28s %8ss\n" "$name${N:+ (N=$N)}" "$seconds"
+done
@@ -0,0 +1,26 @@
+#!/bin/bash
+# Times `rox compile` (codegen + clang++) over a corpus of programs and reports the
+# total wall time and the average size of the generated C++.
+# Usage: bench/compile_time.sh [file.rox ...]   (defaults to test/*.rox)
+# ROX=path/to/rox picks the compiler to time (default: ./rox). Programs that do not
+# compile (the expected-failure tests) are skipped.
+
+cd "$(dirname "$0")/.."
+
+ROX=${ROX:-./rox}
+files=("$@")
+if [ ${#files[@]} -eq 0 ]; then
+    files=(test/*.rox)
+fi
+
+TIMEFORMAT="%R"
+for f in "${files[@]}"; do
+    name=$(basename "$f" .rox)
+    seconds=$( { time "$ROX" compile "$f" > /dev/null 2>&1; } 2>&1 ) || continue
+    echo "$seconds $(wc -c < "generated/$name.cc")"
+done | awk '
+    { n++; total += $1; bytes += $2 }
+    END {
+        if (n == 0) { print "No programs compiled."; exit 1 }
+        printf "%d programs, %.2fs total, %.3fs per program, %d bytes of C++ per program\n", n, total, total / n, bytes / n
+    }'
@@ -0,0 +1,31 @@
+#!/bin/bash
+# Writes a ROX program of N (default 5000) small functions, about 20 lines each, to
+# stdout: a large source for timing codegen, e.g.
+#   N=5000 bench/gen_functions.sh > /tmp/big.rox && time ./rox generate /tmp/big.rox --jobs 1
+awk -v n="${N:-5000}" 'BEGIN {
+    for (i = 0; i < n; i++) {
+        printf "function f%d(list[int64] xs, int64 k) -> int64 {\n", i
+        print "    int64 acc = 0;"
+        print "    for x in xs {"
+        print "        if (x > k) {"
+        print "            acc = acc + x * 3;"
+        print "        } else {"
+        print "            acc = acc - 1;"
+        print "        }"
+        print "    }"
+        print "    rox_result[int64] q = acc / 7;"
+        print "    if (isOk(q)) {"
+        print "        acc = getValue(q);"
+        print "    }"
+        print "    dictionary[int64, int64] seen;"
+        print "    seen.set(k, acc);"
+        if (i > 0) printf "    return acc + f%d(xs, k + 1) * 0;\n", i - 1
+        else print "    return acc;"
+        print "}"
+        print ""
+    }
+    print "function main() -> none {"
+    print "    list[int64] xs = [1, 2, 3, 4, 5];"
+    printf "    print(f%d(xs, 2), \"\\n\");\n", n - 1
+    print "}"
+}'
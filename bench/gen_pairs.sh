@@ -0,0 +1,3 @@
+#!/bin/bash
+# Writes N (default 20000000) lines of "<int64> <float64>" to stdout.
+awk -v n="${N:-20000000}" 'BEGIN { for (i = 0; i < n; i++) print (i * 7919) % 1000003, i * 0.5 }'
@@ -0,0 +1,20 @@
+#!/bin/bash
+# Runs the parallel benchmarks with 1, 2, 4, ... threads up to the core count.
+# Usage: bench/scaling.sh [bench/file.rox ...]   (defaults to the parallel_* benchmarks)
+
+cd "$(dirname "$0")/.."
+
+files=("$@")
+if [ ${#files[@]} -eq 0 ]; then
+    files=(bench/parallel_*.rox)
+fi
+
+cores=$(nproc)
+threads=1
+while :; do
+    echo "ROX_THREADS=$threads"
+    ROX_THREADS=$threads ./bench/bench.sh "${files[@]}" | tail -n +3
+    [ "$threads" -ge "$cores" ] && break
+    threads=$((threads * 2))
+    [ "$threads" -gt "$cores" ] && threads=$cores
+done
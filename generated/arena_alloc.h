@@ -0,0 +1,263 @@
+#pragma once
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+#include <memory_resource>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+inline const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+inline RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+inline std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+inline RoxOut rox_out;
+inline void rox_flush_stdout() { rox_out.flush(); }
+
+inline void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+inline void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+inline void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+inline void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+inline void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+inline void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// Block-scoped arena for lists and dictionaries that never leave their block.
+// The first 1 KiB comes from the stack; everything is released when the block exits.
+struct RoxArena : std::pmr::monotonic_buffer_resource {
+    alignas(std::max_align_t) std::byte buffer[1024];
+    RoxArena() : std::pmr::monotonic_buffer_resource(buffer, sizeof buffer) {}
+};
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+inline rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+inline rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+// Division
+template<typename T>
+rox_result<T> rox_div(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a / b);
+}
+
+// Modulo
+template<typename T>
+rox_result<T> rox_mod(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a % b);
+}
+
+// Division and modulo by a divisor proven nonzero at compile time
+template<typename T>
+rox_result<T> rox_div_unchecked(T a, T b) {
+    return {a / b, RoxString()};
+}
+template<typename T>
+rox_result<T> rox_mod_unchecked(T a, T b) {
+    return {a % b, RoxString()};
+}
+
+// Dictionary Hash for RoxString
+namespace std {
+    template <> struct hash<RoxString> {
+        size_t operator()(const RoxString& s) const {
+            return hash<string>()(s.val);
+        }
+    };
+}
+
+// Dictionary Access
+template<typename K, typename V, typename H, typename E, typename A>
+rox_result<V> rox_get(const std::unordered_map<K, V, H, E, A>& dict, K key) {
+    auto it = dict.find(key);
+    if (it == dict.end()) return error<V>("Key not found");
+    return ok(it->second);
+}
+
+// Dictionary Set
+template<typename K, typename V, typename H, typename E, typename A>
+void rox_set(std::unordered_map<K, V, H, E, A>& dict, K key, V val) {
+    dict.insert_or_assign(key, val);
+}
+
+// Dictionary Remove
+template<typename K, typename V, typename H, typename E, typename A>
+void rox_remove(std::unordered_map<K, V, H, E, A>& dict, K key) {
+    dict.erase(key);
+}
+
+// Dictionary Has
+template<typename K, typename V, typename H, typename E, typename A>
+bool rox_has(const std::unordered_map<K, V, H, E, A>& dict, K key) {
+    return dict.find(key) != dict.end();
+}
+
+// Dictionary Keys
+template<typename K, typename V, typename H, typename E, typename A>
+std::vector<K> rox_keys(const std::unordered_map<K, V, H, E, A>& dict) {
+    std::vector<K> keys;
+    keys.reserve(dict.size());
+    for (const auto& kv : dict) {
+        keys.push_back(kv.first);
+    }
+    return keys;
+}
+
+
+
+// End Runtime
+
+int64_t roxv26_distinct_sum(int64_t roxv26_seed);
+
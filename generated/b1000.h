@@ -0,0 +1,1262 @@
+#pragma once
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+#include <memory_resource>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+inline const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+inline RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+inline std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+inline RoxOut rox_out;
+inline void rox_flush_stdout() { rox_out.flush(); }
+
+inline void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+inline void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+inline void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+inline void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+inline void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+inline void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// Block-scoped arena for lists and dictionaries that never leave their block.
+// The first 1 KiB comes from the stack; everything is released when the block exits.
+struct RoxArena : std::pmr::monotonic_buffer_resource {
+    alignas(std::max_align_t) std::byte buffer[1024];
+    RoxArena() : std::pmr::monotonic_buffer_resource(buffer, sizeof buffer) {}
+};
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+inline rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+inline rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+// Division
+template<typename T>
+rox_result<T> rox_div(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a / b);
+}
+
+// Modulo
+template<typename T>
+rox_result<T> rox_mod(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a % b);
+}
+
+// Division and modulo by a divisor proven nonzero at compile time
+template<typename T>
+rox_result<T> rox_div_unchecked(T a, T b) {
+    return {a / b, RoxString()};
+}
+template<typename T>
+rox_result<T> rox_mod_unchecked(T a, T b) {
+    return {a % b, RoxString()};
+}
+
+// Dictionary Hash for RoxString
+namespace std {
+    template <> struct hash<RoxString> {
+        size_t operator()(const RoxString& s) const {
+            return hash<string>()(s.val);
+        }
+    };
+}
+
+// Dictionary Access
+template<typename K, typename V, typename H, typename E, typename A>
+rox_result<V> rox_get(const std::unordered_map<K, V, H, E, A>& dict, K key) {
+    auto it = dict.find(key);
+    if (it == dict.end()) return error<V>("Key not found");
+    return ok(it->second);
+}
+
+// Dictionary Set
+template<typename K, typename V, typename H, typename E, typename A>
+void rox_set(std::unordered_map<K, V, H, E, A>& dict, K key, V val) {
+    dict.insert_or_assign(key, val);
+}
+
+// Dictionary Remove
+template<typename K, typename V, typename H, typename E, typename A>
+void rox_remove(std::unordered_map<K, V, H, E, A>& dict, K key) {
+    dict.erase(key);
+}
+
+// Dictionary Has
+template<typename K, typename V, typename H, typename E, typename A>
+bool rox_has(const std::unordered_map<K, V, H, E, A>& dict, K key) {
+    return dict.find(key) != dict.end();
+}
+
+// Dictionary Keys
+template<typename K, typename V, typename H, typename E, typename A>
+std::vector<K> rox_keys(const std::unordered_map<K, V, H, E, A>& dict) {
+    std::vector<K> keys;
+    keys.reserve(dict.size());
+    for (const auto& kv : dict) {
+        keys.push_back(kv.first);
+    }
+    return keys;
+}
+
+
+
+// End Runtime
+
+int64_t roxv26_f0(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f1(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f2(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f3(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f4(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f5(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f6(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f7(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f8(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f9(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f10(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f11(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f12(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f13(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f14(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f15(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f16(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f17(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f18(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f19(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f20(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f21(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f22(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f23(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f24(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f25(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f26(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f27(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f28(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f29(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f30(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f31(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f32(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f33(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f34(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f35(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f36(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f37(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f38(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f39(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f40(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f41(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f42(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f43(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f44(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f45(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f46(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f47(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f48(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f49(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f50(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f51(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f52(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f53(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f54(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f55(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f56(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f57(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f58(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f59(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f60(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f61(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f62(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f63(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f64(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f65(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f66(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f67(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f68(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f69(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f70(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f71(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f72(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f73(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f74(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f75(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f76(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f77(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f78(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f79(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f80(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f81(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f82(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f83(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f84(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f85(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f86(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f87(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f88(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f89(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f90(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f91(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f92(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f93(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f94(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f95(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f96(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f97(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f98(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f99(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f100(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f101(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f102(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f103(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f104(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f105(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f106(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f107(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f108(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f109(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f110(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f111(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f112(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f113(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f114(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f115(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f116(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f117(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f118(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f119(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f120(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f121(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f122(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f123(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f124(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f125(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f126(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f127(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f128(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f129(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f130(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f131(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f132(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f133(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f134(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f135(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f136(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f137(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f138(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f139(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f140(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f141(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f142(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f143(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f144(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f145(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f146(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f147(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f148(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f149(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f150(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f151(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f152(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f153(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f154(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f155(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f156(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f157(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f158(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f159(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f160(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f161(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f162(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f163(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f164(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f165(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f166(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f167(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f168(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f169(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f170(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f171(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f172(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f173(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f174(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f175(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f176(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f177(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f178(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f179(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f180(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f181(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f182(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f183(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f184(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f185(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f186(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f187(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f188(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f189(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f190(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f191(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f192(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f193(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f194(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f195(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f196(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f197(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f198(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f199(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f200(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f201(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f202(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f203(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f204(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f205(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f206(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f207(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f208(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f209(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f210(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f211(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f212(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f213(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f214(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f215(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f216(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f217(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f218(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f219(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f220(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f221(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f222(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f223(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f224(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f225(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f226(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f227(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f228(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f229(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f230(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f231(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f232(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f233(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f234(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f235(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f236(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f237(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f238(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f239(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f240(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f241(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f242(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f243(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f244(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f245(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f246(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f247(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f248(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f249(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f250(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f251(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f252(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f253(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f254(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f255(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f256(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f257(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f258(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f259(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f260(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f261(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f262(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f263(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f264(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f265(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f266(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f267(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f268(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f269(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f270(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f271(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f272(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f273(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f274(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f275(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f276(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f277(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f278(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f279(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f280(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f281(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f282(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f283(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f284(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f285(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f286(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f287(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f288(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f289(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f290(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f291(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f292(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f293(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f294(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f295(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f296(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f297(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f298(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f299(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f300(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f301(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f302(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f303(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f304(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f305(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f306(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f307(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f308(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f309(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f310(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f311(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f312(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f313(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f314(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f315(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f316(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f317(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f318(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f319(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f320(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f321(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f322(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f323(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f324(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f325(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f326(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f327(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f328(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f329(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f330(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f331(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f332(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f333(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f334(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f335(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f336(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f337(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f338(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f339(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f340(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f341(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f342(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f343(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f344(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f345(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f346(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f347(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f348(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f349(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f350(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f351(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f352(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f353(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f354(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f355(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f356(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f357(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f358(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f359(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f360(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f361(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f362(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f363(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f364(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f365(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f366(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f367(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f368(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f369(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f370(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f371(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f372(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f373(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f374(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f375(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f376(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f377(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f378(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f379(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f380(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f381(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f382(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f383(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f384(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f385(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f386(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f387(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f388(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f389(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f390(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f391(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f392(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f393(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f394(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f395(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f396(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f397(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f398(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f399(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f400(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f401(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f402(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f403(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f404(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f405(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f406(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f407(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f408(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f409(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f410(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f411(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f412(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f413(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f414(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f415(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f416(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f417(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f418(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f419(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f420(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f421(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f422(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f423(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f424(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f425(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f426(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f427(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f428(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f429(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f430(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f431(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f432(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f433(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f434(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f435(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f436(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f437(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f438(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f439(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f440(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f441(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f442(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f443(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f444(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f445(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f446(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f447(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f448(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f449(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f450(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f451(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f452(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f453(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f454(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f455(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f456(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f457(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f458(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f459(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f460(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f461(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f462(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f463(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f464(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f465(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f466(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f467(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f468(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f469(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f470(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f471(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f472(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f473(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f474(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f475(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f476(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f477(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f478(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f479(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f480(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f481(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f482(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f483(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f484(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f485(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f486(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f487(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f488(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f489(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f490(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f491(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f492(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f493(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f494(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f495(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f496(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f497(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f498(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f499(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f500(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f501(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f502(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f503(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f504(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f505(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f506(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f507(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f508(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f509(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f510(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f511(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f512(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f513(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f514(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f515(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f516(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f517(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f518(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f519(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f520(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f521(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f522(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f523(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f524(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f525(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f526(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f527(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f528(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f529(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f530(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f531(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f532(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f533(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f534(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f535(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f536(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f537(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f538(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f539(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f540(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f541(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f542(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f543(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f544(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f545(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f546(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f547(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f548(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f549(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f550(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f551(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f552(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f553(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f554(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f555(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f556(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f557(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f558(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f559(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f560(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f561(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f562(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f563(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f564(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f565(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f566(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f567(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f568(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f569(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f570(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f571(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f572(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f573(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f574(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f575(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f576(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f577(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f578(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f579(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f580(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f581(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f582(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f583(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f584(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f585(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f586(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f587(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f588(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f589(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f590(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f591(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f592(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f593(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f594(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f595(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f596(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f597(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f598(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f599(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f600(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f601(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f602(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f603(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f604(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f605(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f606(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f607(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f608(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f609(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f610(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f611(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f612(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f613(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f614(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f615(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f616(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f617(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f618(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f619(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f620(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f621(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f622(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f623(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f624(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f625(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f626(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f627(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f628(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f629(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f630(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f631(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f632(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f633(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f634(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f635(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f636(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f637(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f638(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f639(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f640(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f641(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f642(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f643(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f644(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f645(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f646(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f647(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f648(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f649(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f650(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f651(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f652(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f653(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f654(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f655(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f656(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f657(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f658(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f659(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f660(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f661(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f662(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f663(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f664(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f665(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f666(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f667(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f668(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f669(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f670(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f671(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f672(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f673(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f674(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f675(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f676(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f677(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f678(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f679(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f680(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f681(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f682(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f683(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f684(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f685(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f686(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f687(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f688(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f689(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f690(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f691(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f692(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f693(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f694(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f695(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f696(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f697(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f698(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f699(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f700(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f701(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f702(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f703(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f704(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f705(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f706(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f707(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f708(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f709(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f710(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f711(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f712(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f713(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f714(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f715(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f716(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f717(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f718(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f719(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f720(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f721(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f722(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f723(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f724(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f725(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f726(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f727(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f728(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f729(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f730(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f731(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f732(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f733(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f734(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f735(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f736(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f737(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f738(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f739(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f740(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f741(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f742(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f743(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f744(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f745(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f746(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f747(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f748(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f749(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f750(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f751(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f752(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f753(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f754(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f755(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f756(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f757(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f758(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f759(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f760(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f761(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f762(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f763(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f764(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f765(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f766(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f767(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f768(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f769(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f770(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f771(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f772(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f773(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f774(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f775(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f776(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f777(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f778(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f779(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f780(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f781(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f782(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f783(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f784(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f785(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f786(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f787(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f788(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f789(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f790(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f791(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f792(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f793(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f794(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f795(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f796(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f797(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f798(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f799(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f800(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f801(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f802(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f803(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f804(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f805(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f806(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f807(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f808(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f809(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f810(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f811(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f812(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f813(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f814(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f815(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f816(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f817(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f818(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f819(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f820(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f821(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f822(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f823(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f824(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f825(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f826(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f827(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f828(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f829(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f830(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f831(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f832(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f833(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f834(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f835(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f836(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f837(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f838(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f839(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f840(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f841(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f842(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f843(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f844(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f845(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f846(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f847(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f848(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f849(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f850(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f851(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f852(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f853(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f854(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f855(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f856(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f857(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f858(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f859(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f860(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f861(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f862(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f863(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f864(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f865(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f866(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f867(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f868(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f869(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f870(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f871(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f872(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f873(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f874(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f875(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f876(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f877(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f878(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f879(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f880(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f881(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f882(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f883(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f884(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f885(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f886(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f887(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f888(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f889(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f890(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f891(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f892(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f893(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f894(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f895(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f896(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f897(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f898(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f899(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f900(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f901(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f902(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f903(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f904(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f905(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f906(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f907(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f908(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f909(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f910(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f911(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f912(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f913(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f914(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f915(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f916(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f917(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f918(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f919(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f920(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f921(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f922(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f923(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f924(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f925(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f926(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f927(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f928(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f929(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f930(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f931(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f932(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f933(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f934(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f935(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f936(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f937(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f938(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f939(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f940(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f941(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f942(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f943(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f944(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f945(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f946(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f947(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f948(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f949(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f950(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f951(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f952(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f953(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f954(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f955(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f956(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f957(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f958(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f959(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f960(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f961(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f962(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f963(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f964(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f965(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f966(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f967(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f968(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f969(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f970(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f971(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f972(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f973(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f974(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f975(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f976(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f977(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f978(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f979(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f980(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f981(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f982(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f983(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f984(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f985(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f986(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f987(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f988(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f989(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f990(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f991(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f992(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f993(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f994(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f995(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f996(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f997(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f998(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f999(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+
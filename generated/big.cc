@@ -0,0 +1,2266 @@
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+#include <memory_resource>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// Block-scoped arena for lists and dictionaries that never leave their block.
+// The first 1 KiB comes from the stack; everything is released when the block exits.
+struct RoxArena : std::pmr::monotonic_buffer_resource {
+    alignas(std::max_align_t) std::byte buffer[1024];
+    RoxArena() : std::pmr::monotonic_buffer_resource(buffer, sizeof buffer) {}
+};
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+// Division
+template<typename T>
+rox_result<T> rox_div(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a / b);
+}
+
+// Modulo
+template<typename T>
+rox_result<T> rox_mod(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a % b);
+}
+
+// Division and modulo by a divisor proven nonzero at compile time
+template<typename T>
+rox_result<T> rox_div_unchecked(T a, T b) {
+    return {a / b, RoxString()};
+}
+template<typename T>
+rox_result<T> rox_mod_unchecked(T a, T b) {
+    return {a % b, RoxString()};
+}
+
+// Dictionary Hash for RoxString
+namespace std {
+    template <> struct hash<RoxString> {
+        size_t operator()(const RoxString& s) const {
+            return hash<string>()(s.val);
+        }
+    };
+}
+
+// Dictionary Access
+template<typename K, typename V, typename H, typename E, typename A>
+rox_result<V> rox_get(const std::unordered_map<K, V, H, E, A>& dict, K key) {
+    auto it = dict.find(key);
+    if (it == dict.end()) return error<V>("Key not found");
+    return ok(it->second);
+}
+
+// Dictionary Set
+template<typename K, typename V, typename H, typename E, typename A>
+void rox_set(std::unordered_map<K, V, H, E, A>& dict, K key, V val) {
+    dict.insert_or_assign(key, val);
+}
+
+// Dictionary Remove
+template<typename K, typename V, typename H, typename E, typename A>
+void rox_remove(std::unordered_map<K, V, H, E, A>& dict, K key) {
+    dict.erase(key);
+}
+
+// Dictionary Has
+template<typename K, typename V, typename H, typename E, typename A>
+bool rox_has(const std::unordered_map<K, V, H, E, A>& dict, K key) {
+    return dict.find(key) != dict.end();
+}
+
+// Dictionary Keys
+template<typename K, typename V, typename H, typename E, typename A>
+std::vector<K> rox_keys(const std::unordered_map<K, V, H, E, A>& dict) {
+    std::vector<K> keys;
+    keys.reserve(dict.size());
+    for (const auto& kv : dict) {
+        keys.push_back(kv.first);
+    }
+    return keys;
+}
+
+
+
+// End Runtime
+
+int64_t roxv26_f0(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f1(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f2(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f3(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f4(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f5(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f6(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f7(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f8(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f9(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f10(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f11(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f12(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f13(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f14(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f15(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f16(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f17(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f18(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f19(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f20(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f21(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f22(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f23(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f24(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f25(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f26(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f27(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f28(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f29(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f30(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f31(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f32(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f33(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f34(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f35(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f36(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f37(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f38(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f39(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f40(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f41(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f42(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f43(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f44(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f45(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f46(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f47(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f48(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f49(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f50(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f51(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f52(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f53(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f54(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f55(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f56(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f57(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f58(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f59(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f60(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f61(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f62(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f63(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f64(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f65(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f66(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f67(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f68(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f69(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f70(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f71(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f72(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f73(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f74(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f75(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f76(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f77(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f78(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f79(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f80(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f81(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f82(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f83(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f84(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f85(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f86(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f87(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f88(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f89(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f90(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f91(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f92(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f93(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f94(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f95(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f96(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f97(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f98(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+int64_t roxv26_f99(std::vector<int64_t> roxv26_xs, int64_t roxv26_k);
+
+int64_t roxv26_f0(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return roxv26_acc;
+}
+int64_t roxv26_f1(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f0(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f2(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f1(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f3(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f2(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f4(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f3(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f5(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f4(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f6(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f5(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f7(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f6(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f8(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f7(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f9(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f8(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f10(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f9(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f11(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f10(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f12(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f11(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f13(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f12(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f14(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f13(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f15(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f14(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f16(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f15(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f17(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f16(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f18(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f17(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f19(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f18(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f20(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f19(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f21(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f20(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f22(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f21(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f23(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f22(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f24(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f23(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f25(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f24(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f26(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f25(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f27(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f26(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f28(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f27(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f29(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f28(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f30(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f29(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f31(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f30(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f32(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f31(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f33(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f32(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f34(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f33(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f35(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f34(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f36(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f35(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f37(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f36(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f38(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f37(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f39(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f38(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f40(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f39(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f41(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f40(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f42(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f41(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f43(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f42(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f44(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f43(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f45(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f44(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f46(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f45(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f47(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f46(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f48(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f47(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f49(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f48(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f50(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f49(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f51(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f50(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f52(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f51(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f53(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f52(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f54(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f53(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f55(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f54(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f56(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f55(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f57(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f56(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f58(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f57(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f59(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f58(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f60(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f59(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f61(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f60(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f62(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f61(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f63(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f62(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f64(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f63(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f65(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f64(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f66(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f65(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f67(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f66(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f68(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f67(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f69(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f68(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f70(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f69(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f71(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f70(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f72(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f71(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f73(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f72(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f74(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f73(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f75(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f74(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f76(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f75(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f77(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f76(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f78(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f77(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f79(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f78(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f80(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f79(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f81(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f80(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f82(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f81(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f83(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f82(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f84(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f83(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f85(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f84(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f86(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f85(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f87(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f86(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f88(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f87(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f89(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f88(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f90(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f89(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f91(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f90(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f92(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f91(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f93(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f92(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f94(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f93(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f95(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f94(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f96(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f95(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f97(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f96(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f98(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f97(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int64_t roxv26_f99(std::vector<int64_t> roxv26_xs, int64_t roxv26_k) {
+  RoxArena roxv26__arena;
+  int64_t roxv26_acc = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x > roxv26_k))     {
+      (roxv26_acc = (roxv26_acc + (roxv26_x * ((int64_t)3))));
+    }
+    else     {
+      (roxv26_acc = (roxv26_acc - ((int64_t)1)));
+    }
+  }
+  rox_result<int64_t> roxv26_q = rox_div_unchecked(roxv26_acc, ((int64_t)7));
+  if (true)   {
+    (roxv26_acc = roxv26_q.value);
+  }
+  std::pmr::unordered_map<int64_t, int64_t> roxv26_seen(&roxv26__arena);
+  rox_set(roxv26_seen, roxv26_k, roxv26_acc);
+  return (roxv26_acc + (roxv26_f98(roxv26_xs, (roxv26_k + ((int64_t)1))) * ((int64_t)0)));
+}
+int main() {
+  std::vector<int64_t> roxv26_xs = std::vector<int64_t>{((int64_t)1), ((int64_t)2), ((int64_t)3), ((int64_t)4), ((int64_t)5)};
+  print(roxv26_f99(roxv26_xs, ((int64_t)2)), rox_str("\n"));
+  return 0;
+}
@@ -0,0 +1,251 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+// Division
+template<typename T>
+rox_result<T> rox_div(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a / b);
+}
+
+// Modulo
+template<typename T>
+rox_result<T> rox_mod(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a % b);
+}
+
+// Division and modulo by a divisor proven nonzero at compile time
+template<typename T>
+rox_result<T> rox_div_unchecked(T a, T b) {
+    return {a / b, RoxString()};
+}
+template<typename T>
+rox_result<T> rox_mod_unchecked(T a, T b) {
+    return {a % b, RoxString()};
+}
+
+
+
+// End Runtime
+
+int64_t roxv26_binary_search_recursive(std::vector<int64_t> roxv26_int64s, int64_t roxv26_target, int64_t roxv26_low, int64_t roxv26_high);
+int64_t roxv26_search(std::vector<int64_t> roxv26_int64s, int64_t roxv26_target);
+
+int64_t roxv26_binary_search_recursive(std::vector<int64_t> roxv26_int64s, int64_t roxv26_target, int64_t roxv26_low, int64_t roxv26_high) {
+  if ((roxv26_low > roxv26_high))   {
+    return (-((int64_t)1));
+  }
+  int64_t roxv26_diff = (roxv26_high - roxv26_low);
+  rox_result<int64_t> roxv26_r_div = rox_div_unchecked(roxv26_diff, ((int64_t)2));
+  if (true)   {
+    int64_t roxv26_half = roxv26_r_div.value;
+    int64_t roxv26_mid = (roxv26_low + roxv26_half);
+    rox_result<int64_t> roxv26_r = rox_at(roxv26_int64s, roxv26_mid);
+    if (isOk(roxv26_r))     {
+      int64_t roxv26_midVal = getValue(roxv26_r);
+      if ((roxv26_midVal == roxv26_target))       {
+        return roxv26_mid;
+      }
+      else       if ((roxv26_midVal < roxv26_target))       {
+        return roxv26_binary_search_recursive(roxv26_int64s, roxv26_target, (roxv26_mid + ((int64_t)1)), roxv26_high);
+      }
+      else       {
+        return roxv26_binary_search_recursive(roxv26_int64s, roxv26_target, roxv26_low, (roxv26_mid - ((int64_t)1)));
+      }
+    }
+  }
+  return (-((int64_t)1));
+}
+int64_t roxv26_search(std::vector<int64_t> roxv26_int64s, int64_t roxv26_target) {
+  int64_t roxv26_n = ((int64_t)roxv26_int64s.size());
+  if ((roxv26_n == ((int64_t)0)))   {
+    return (-((int64_t)1));
+  }
+  return roxv26_binary_search_recursive(roxv26_int64s, roxv26_target, ((int64_t)0), (roxv26_n - ((int64_t)1)));
+}
+int main() {
+  std::vector<int64_t> roxv26_int64s = std::vector<int64_t>{(-((int64_t)1)), ((int64_t)0), ((int64_t)3), ((int64_t)5), ((int64_t)9), ((int64_t)12)};
+  if ((roxv26_search(roxv26_int64s, ((int64_t)9)) == ((int64_t)4)))   {
+    if ((roxv26_search(roxv26_int64s, ((int64_t)2)) == (-((int64_t)1))))     {
+      print(rox_str("Binary Search: Passed\n"));
+      return 0;
+    }
+  }
+  print(rox_str("Binary Search: Failed\n"));
+  return 0;
+}
@@ -0,0 +1,188 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+#include <utility>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// Function values: ROX functions are top-level and never capture, so a
+// function-typed value is a plain pointer.
+template<typename F>
+using RoxFn = F*;
+
+// A function known at compile time, passed to a callback parameter. Its type names
+// the function, so each callee is instantiated with a direct, inlinable call.
+template<auto F>
+struct RoxKnownFn {
+    template<typename... A>
+    decltype(auto) operator()(A&&... a) const { return F(std::forward<A>(a)...); }
+    constexpr operator decltype(F)() const { return F; }
+};
+
+
+
+// End Runtime
+
+int64_t roxv26_square(int64_t roxv26_x);
+int64_t roxv26_shift(int64_t roxv26_x);
+int64_t roxv26_add(int64_t roxv26_a, int64_t roxv26_b);
+int64_t roxv26_larger(int64_t roxv26_a, int64_t roxv26_b);
+template<typename roxv26__F2, typename roxv26__F3>
+int64_t roxv26_map_fold(std::vector<int64_t> roxv26_xs, int64_t roxv26_init, roxv26__F2 roxv26_f, roxv26__F3 roxv26_combine);
+
+int64_t roxv26_square(int64_t roxv26_x) {
+  return (roxv26_x * roxv26_x);
+}
+int64_t roxv26_shift(int64_t roxv26_x) {
+  return ((roxv26_x * ((int64_t)3)) + ((int64_t)1));
+}
+int64_t roxv26_add(int64_t roxv26_a, int64_t roxv26_b) {
+  return (roxv26_a + roxv26_b);
+}
+int64_t roxv26_larger(int64_t roxv26_a, int64_t roxv26_b) {
+  if ((roxv26_a > roxv26_b))   {
+    return roxv26_a;
+  }
+  return roxv26_b;
+}
+template<typename roxv26__F2, typename roxv26__F3>
+int64_t roxv26_map_fold(std::vector<int64_t> roxv26_xs, int64_t roxv26_init, roxv26__F2 roxv26_f, roxv26__F3 roxv26_combine) {
+  int64_t roxv26_acc = roxv26_init;
+  for (auto roxv26_x : roxv26_xs)   {
+    (roxv26_acc = roxv26_combine(roxv26_acc, roxv26_f(roxv26_x)));
+  }
+  return roxv26_acc;
+}
+int main() {
+  int64_t roxv26_n = ((int64_t)10000000);
+  std::vector<int64_t> roxv26_xs = std::vector<int64_t>{};
+  int64_t roxv26_v = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = roxv26_n; roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    roxv26_xs.push_back(roxv26_v);
+    (roxv26_v = (roxv26_v + ((int64_t)1)));
+    if ((roxv26_v == ((int64_t)65536)))     {
+      (roxv26_v = ((int64_t)0));
+    }
+  }
+  int64_t roxv26_checksum = ((int64_t)0);
+  for (int64_t roxv26_round = ((int64_t)0), roxv26__end1 = ((int64_t)10); roxv26_round < roxv26__end1; roxv26_round += ((int64_t)1))   {
+    (roxv26_checksum = (roxv26_checksum + roxv26_map_fold(roxv26_xs, roxv26_round, RoxKnownFn<&roxv26_square>{}, RoxKnownFn<&roxv26_add>{})));
+    (roxv26_checksum = (roxv26_checksum + roxv26_map_fold(roxv26_xs, roxv26_round, RoxKnownFn<&roxv26_shift>{}, RoxKnownFn<&roxv26_larger>{})));
+  }
+  print(roxv26_checksum, rox_str("\n"));
+  return 0;
+}
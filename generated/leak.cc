@@ -0,0 +1,443 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <functional>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <limits>
+#include <cstdlib>
+#include <deque>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// Function values: ROX functions are top-level and never capture, so a
+// function-typed value is a plain pointer.
+template<typename F>
+using RoxFn = F*;
+
+// A function known at compile time, passed to a callback parameter. Its type names
+// the function, so each callee is instantiated with a direct, inlinable call.
+template<auto F>
+struct RoxKnownFn {
+    template<typename... A>
+    decltype(auto) operator()(A&&... a) const { return F(std::forward<A>(a)...); }
+    constexpr operator decltype(F)() const { return F; }
+};
+
+
+// Set while running a parallel loop chunk or a task; parallel loops started there run serially.
+thread_local bool rox_in_parallel = false;
+// Index of the pool slot owned by this thread (0 for the main thread).
+thread_local int rox_worker = 0;
+
+// A spawned task. state goes 0 (queued) -> 1 (claimed) -> 2 (done); whoever claims it
+// runs it: a pool worker, or the thread that joins it before anyone else got to it.
+struct RoxTaskBase {
+    std::atomic<int> state{0};
+    virtual ~RoxTaskBase() = default;
+    virtual void execute() = 0;
+    bool claim() {
+        int expected = 0;
+        return state.compare_exchange_strong(expected, 1);
+    }
+    void runClaimed() {
+        bool outer = rox_in_parallel;
+        rox_in_parallel = true;
+        execute();
+        rox_in_parallel = outer;
+        state.store(2);
+        state.notify_all();
+    }
+};
+
+// Parallel loops and tasks: a work-stealing pool of ROX_THREADS workers (default: one
+// per hardware thread). The calling thread works too. For loops, each worker owns a
+// contiguous range of chunk indices, takes from its front and steals from the back of
+// others. Spawned tasks go on the spawning thread's deque: the owner pops the newest,
+// thieves take the oldest.
+class RoxPool {
+public:
+    explicit RoxPool(int workers) : slots(workers) {
+        for (int w = 1; w < workers; ++w) std::thread([this, w] { workerLoop(w); }).detach();
+    }
+    int size() const { return (int)slots.size(); }
+
+    // Runs task(c) for every c in [0, chunks) and returns when all have finished.
+    void run(int64_t chunks, const std::function<void(int64_t)>& task) {
+        int64_t lo = 0;
+        for (int w = 0; w < size(); ++w) {
+            int64_t hi = lo + chunks / size() + (w < chunks % size() ? 1 : 0);
+            std::lock_guard<std::mutex> guard(slots[w].m);
+            slots[w].lo = lo;
+            slots[w].hi = hi;
+            lo = hi;
+        }
+        pending.store(chunks);
+        {
+            std::lock_guard<std::mutex> lock(m);
+            current = &task;
+            ++generation;
+        }
+        wake.notify_all();
+        work(0, task);
+        std::unique_lock<std::mutex> lock(m);
+        finished.wait(lock, [&] { return pending.load() == 0 && busy == 0; });
+        current = nullptr;
+    }
+
+    void submit(std::shared_ptr<RoxTaskBase> task) {
+        {
+            Slot& own = slots[rox_worker];
+            std::lock_guard<std::mutex> guard(own.m);
+            own.tasks.push_back(std::move(task));
+        }
+        queued.fetch_add(1);
+        // Only pay for a wakeup when a worker is actually asleep.
+        if (sleeping.load() > 0) {
+            std::lock_guard<std::mutex> lock(m);
+            wake.notify_one();
+        }
+    }
+
+    // Runs other tasks while waiting for target to finish.
+    void helpUntil(RoxTaskBase& target) {
+        std::shared_ptr<RoxTaskBase> task;
+        while (target.state.load() != 2) {
+            if (takeTask(rox_worker, task)) {
+                if (task->claim()) task->runClaimed();
+                task.reset();
+            } else {
+                target.state.wait(1);
+            }
+        }
+    }
+
+    // Drops tasks that join() already ran from the newest end of this thread's deque.
+    // Nothing else would pop them when no worker steals, e.g. with ROX_THREADS=1.
+    void discardClaimed() {
+        Slot& own = slots[rox_worker];
+        std::lock_guard<std::mutex> guard(own.m);
+        while (!own.tasks.empty() && own.tasks.back()->state.load() != 0) {
+            own.tasks.pop_back();
+            queued.fetch_sub(1);
+        }
+    }
+
+private:
+    struct alignas(64) Slot {
+        std::mutex m;
+        int64_t lo = 0, hi = 0;
+        std::deque<std::shared_ptr<RoxTaskBase>> tasks;
+    };
+    std::vector<Slot> slots;
+    std::mutex m;
+    std::condition_variable wake, finished;
+    const std::function<void(int64_t)>* current = nullptr;
+    uint64_t generation = 0;
+    int busy = 0;
+    std::atomic<int64_t> pending{0};
+    std::atomic<int64_t> queued{0};
+    std::atomic<int> sleeping{0};
+
+    bool take(int self, int64_t& chunk) {
+        {
+            Slot& own = slots[self];
+            std::lock_guard<std::mutex> guard(own.m);
+            if (own.lo < own.hi) { chunk = own.lo++; return true; }
+        }
+        for (int i = 1; i < size(); ++i) {
+            Slot& victim = slots[(self + i) % size()];
+            std::lock_guard<std::mutex> guard(victim.m);
+            if (victim.lo < victim.hi) { chunk = --victim.hi; return true; }
+        }
+        return false;
+    }
+    void work(int self, const std::function<void(int64_t)>& task) {
+        int64_t chunk;
+        while (take(self, chunk)) {
+            task(chunk);
+            pending.fetch_sub(1);
+        }
+    }
+    bool takeTask(int self, std::shared_ptr<RoxTaskBase>& task) {
+        if (queued.load() == 0) return false;
+        {
+            Slot& own = slots[self];
+            std::lock_guard<std::mutex> guard(own.m);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        for (int i = 1; i < size(); ++i) {
+            Slot& victim = slots[(self + i) % size()];
+            std::lock_guard<std::mutex> guard(victim.m);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+    void workerLoop(int self) {
+        rox_worker = self;
+        uint64_t seen = 0;
+        std::shared_ptr<RoxTaskBase> spawned;
+        while (true) {
+            const std::function<void(int64_t)>* task = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m);
+                ++sleeping;
+                wake.wait(lock, [&] { return generation != seen || queued.load() > 0; });
+                --sleeping;
+                if (generation != seen) {
+                    seen = generation;
+                    task = current; // null if that loop already finished
+                    if (task) ++busy;
+                }
+            }
+            if (task) {
+                work(self, *task);
+                {
+                    std::lock_guard<std::mutex> lock(m);
+                    --busy;
+                }
+                finished.notify_all();
+            }
+            while (takeTask(self, spawned)) {
+                if (spawned->claim()) spawned->runClaimed();
+                spawned.reset();
+            }
+        }
+    }
+};
+
+// Never destroyed: a runtime error may exit() from inside a worker.
+RoxPool& rox_pool() {
+    static RoxPool* pool = [] {
+        const char* env = std::getenv("ROX_THREADS");
+        int n = env ? std::atoi(env) : 0;
+        if (n <= 0) n = (int)std::thread::hardware_concurrency();
+        return new RoxPool(n > 0 ? n : 1);
+    }();
+    return *pool;
+}
+
+// Chunking depends only on the trip count: at most 4096 chunks.
+int64_t rox_parallel_grain(int64_t n) { return n <= 4096 ? 1 : (n + 4095) / 4096; }
+int64_t rox_parallel_chunks(int64_t n) { return n <= 0 ? 0 : (n + rox_parallel_grain(n) - 1) / rox_parallel_grain(n); }
+
+template<typename T> T rox_min_identity() { return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max(); }
+template<typename T> T rox_max_identity() { return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest(); }
+
+// Calls body(chunk, lo, hi) over [0, n). Nested parallel loops run serially.
+template<typename F>
+void rox_parallel_for(int64_t n, F body) {
+    const int64_t grain = rox_parallel_grain(n);
+    const int64_t chunks = rox_parallel_chunks(n);
+    auto runChunk = [&](int64_t c) { body(c, c * grain, std::min(n, (c + 1) * grain)); };
+    if (chunks <= 1 || rox_in_parallel || rox_pool().size() == 1) {
+        for (int64_t c = 0; c < chunks; ++c) runChunk(c);
+        return;
+    }
+    rox_pool().run(chunks, [&](int64_t c) {
+        rox_in_parallel = true;
+        runChunk(c);
+        rox_in_parallel = false;
+    });
+}
+
+// task[T]: spawn(fn, args...) copies the arguments and queues fn on the pool;
+// join(t) returns its result, running it on the spot if no worker has started it.
+template<typename R>
+struct RoxTaskResult : RoxTaskBase {
+    std::optional<R> value;
+};
+
+template<typename R, typename F, typename... Args>
+struct RoxTaskCall : RoxTaskResult<R> {
+    F fn;
+    std::tuple<Args...> args;
+    RoxTaskCall(F fn, Args... args) : fn(fn), args(std::move(args)...) {}
+    void execute() override { this->value.emplace(std::apply(fn, args)); }
+};
+
+template<typename R>
+struct RoxTask {
+    std::shared_ptr<RoxTaskResult<R>> state;
+};
+
+template<typename F, typename... Args>
+auto spawn(F fn, Args... args) {
+    using R = std::decay_t<std::invoke_result_t<F&, Args&...>>;
+    auto task = std::make_shared<RoxTaskCall<R, F, Args...>>(fn, std::move(args)...);
+    rox_pool().submit(task);
+    return RoxTask<R>{std::move(task)};
+}
+
+template<typename R>
+R join(const RoxTask<R>& t) {
+    if (!t.state) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: join() on a task that was never spawned." << std::endl;
+        exit(1);
+    }
+    if (t.state->claim()) {
+        t.state->runClaimed();
+        rox_pool().discardClaimed();
+    } else {
+        rox_pool().helpUntil(*t.state);
+    }
+    return *t.state->value;
+}
+
+
+// End Runtime
+
+int64_t roxv26_total(std::vector<int64_t> roxv26_xs);
+
+int64_t roxv26_total(std::vector<int64_t> roxv26_xs) {
+  int64_t roxv26_sum = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    (roxv26_sum = (roxv26_sum + roxv26_x));
+  }
+  return roxv26_sum;
+}
+int main() {
+  std::vector<int64_t> roxv26_xs = std::vector<int64_t>{};
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)1000); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    roxv26_xs.push_back(roxv26_i);
+  }
+  int64_t roxv26_all = ((int64_t)0);
+  for (int64_t roxv26_k = ((int64_t)0), roxv26__end1 = ((int64_t)20000); roxv26_k < roxv26__end1; roxv26_k += ((int64_t)1))   {
+    RoxTask<int64_t> roxv26_t = spawn(RoxKnownFn<&roxv26_total>{}, roxv26_xs);
+    (roxv26_all = (roxv26_all + join(roxv26_t)));
+  }
+  print(roxv26_all, rox_str("\n"));
+  return 0;
+}
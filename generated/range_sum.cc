@@ -0,0 +1,227 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+int64_t rox_range_count(int64_t start, int64_t end, int64_t step) {
+    if (step == 0) { rox_flush_stdout(); std::cerr << "Runtime Error: range() step cannot be 0." << std::endl; exit(1); }
+    if (step > 0) return start < end ? (int64_t)(((uint64_t)end - (uint64_t)start - 1) / (uint64_t)step + 1) : 0;
+    return start > end ? (int64_t)(((uint64_t)start - (uint64_t)end - 1) / (0 - (uint64_t)step) + 1) : 0;
+}
+
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+
+// End Runtime
+
+int64_t roxv26_sum_list(std::vector<int64_t> roxv26_xs);
+int64_t roxv26_sum_squares(int64_t roxv26_n, int64_t roxv26_step);
+
+int64_t roxv26_sum_list(std::vector<int64_t> roxv26_xs) {
+  int64_t roxv26_total = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)roxv26_xs.size()); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    rox_result<int64_t> roxv26_r = rox_at_unchecked(roxv26_xs, roxv26_i);
+    if (true)     {
+      (roxv26_total = (roxv26_total + roxv26_r.value));
+    }
+  }
+  return roxv26_total;
+}
+int64_t roxv26_sum_squares(int64_t roxv26_n, int64_t roxv26_step) {
+  int64_t roxv26_total = ((int64_t)0);
+  {
+    const int64_t roxv26__start0 = ((int64_t)0);
+    const int64_t roxv26__step0 = roxv26_step;
+    const int64_t roxv26__n0 = rox_range_count(roxv26__start0, roxv26_n, roxv26__step0);
+    for (int64_t roxv26__k0 = 0; roxv26__k0 < roxv26__n0; ++roxv26__k0) {
+      int64_t roxv26_i = roxv26__start0 + roxv26__k0 * roxv26__step0;
+      {
+        (roxv26_total = (roxv26_total + (roxv26_i * roxv26_i)));
+      }
+    }
+  }
+  return roxv26_total;
+}
+int main() {
+  const int64_t roxv26_N = ((int64_t)10000000);
+  std::vector<int64_t> roxv26_xs{};
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)10000000); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    roxv26_xs.push_back((roxv26_i - ((int64_t)3)));
+  }
+  int64_t roxv26_total = ((int64_t)0);
+  for (int64_t roxv26_round = ((int64_t)0), roxv26__end1 = ((int64_t)20); roxv26_round < roxv26__end1; roxv26_round += ((int64_t)1))   {
+    (roxv26_total = ((roxv26_total + roxv26_sum_list(roxv26_xs)) + roxv26_sum_squares(((int64_t)10000000), (roxv26_round + ((int64_t)1)))));
+  }
+  print(roxv26_total, rox_str("\n"));
+  return 0;
+}
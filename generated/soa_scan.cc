@@ -0,0 +1,189 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+
+
+// End Runtime
+
+struct Particle {
+  double roxv26_x;
+  double roxv26_y;
+  double roxv26_z;
+  int64_t roxv26_mass;
+};
+
+struct RoxSoa_Particle {
+  using record_type = Particle;
+  std::vector<double> roxv26_x;
+  std::vector<double> roxv26_y;
+  std::vector<double> roxv26_z;
+  std::vector<int64_t> roxv26_mass;
+  size_t count = 0;
+  RoxSoa_Particle() = default;
+  RoxSoa_Particle(std::initializer_list<Particle> items) { for (const auto& r : items) push_back(r); }
+  size_t size() const { return count; }
+  void push_back(const Particle& r) {
+    roxv26_x.push_back(r.roxv26_x);
+    roxv26_y.push_back(r.roxv26_y);
+    roxv26_z.push_back(r.roxv26_z);
+    roxv26_mass.push_back(r.roxv26_mass);
+    ++count;
+  }
+  void pop_back() {
+    if (count == 0) return;
+    roxv26_x.pop_back();
+    roxv26_y.pop_back();
+    roxv26_z.pop_back();
+    roxv26_mass.pop_back();
+    --count;
+  }
+  Particle operator[](size_t i) const { return Particle{.roxv26_x = roxv26_x[i], .roxv26_y = roxv26_y[i], .roxv26_z = roxv26_z[i], .roxv26_mass = roxv26_mass[i]}; }
+  void assign(size_t i, const Particle& r) {
+    roxv26_x[i] = r.roxv26_x;
+    roxv26_y[i] = r.roxv26_y;
+    roxv26_z[i] = r.roxv26_z;
+    roxv26_mass[i] = r.roxv26_mass;
+  }
+  struct iterator {
+    const RoxSoa_Particle* list;
+    size_t i;
+    Particle operator*() const { return (*list)[i]; }
+    iterator& operator++() { ++i; return *this; }
+    bool operator!=(const iterator& other) const { return i != other.i; }
+  };
+  iterator begin() const { return {this, 0}; }
+  iterator end() const { return {this, count}; }
+};
+
+int main() {
+  int64_t roxv26_n = ((int64_t)2000000);
+  RoxSoa_Particle roxv26_ps = RoxSoa_Particle{};
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = roxv26_n; roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    roxv26_ps.push_back(Particle{.roxv26_x = 1.0, .roxv26_y = 2.0, .roxv26_z = 3.0, .roxv26_mass = roxv26_i});
+  }
+  int64_t roxv26_total = ((int64_t)0);
+  for (int64_t roxv26_round = ((int64_t)0), roxv26__end1 = ((int64_t)50); roxv26_round < roxv26__end1; roxv26_round += ((int64_t)1))   {
+    for (auto roxv26_p : roxv26_ps)     {
+      (roxv26_total = (roxv26_total + roxv26_p.roxv26_mass));
+    }
+  }
+  print(roxv26_total, rox_str("\n"));
+  return 0;
+}
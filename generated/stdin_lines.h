@@ -0,0 +1,248 @@
+#pragma once
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+inline const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+inline RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+inline std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+inline RoxOut rox_out;
+inline void rox_flush_stdout() { rox_out.flush(); }
+
+inline void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+inline void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+inline void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+inline void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+inline void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+inline void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+
+// Block-buffered stdin shared by read_line, read_int64, read_float64 and stdin_lines.
+// Refills with read(2) in 1 MiB chunks; the buffer grows only for longer lines.
+struct RoxIn {
+    std::vector<char> buf = std::vector<char>(1 << 20);
+    size_t pos = 0, end = 0;
+    bool eof = false;
+
+    void fill() {
+        rox_flush_stdout();
+        if (pos > 0) {
+            std::memmove(buf.data(), buf.data() + pos, end - pos);
+            end -= pos;
+            pos = 0;
+        }
+        if (end == buf.size()) buf.resize(buf.size() * 2);
+        while (true) {
+            ssize_t r = ::read(0, buf.data() + end, buf.size() - end);
+            if (r < 0 && errno == EINTR) continue;
+            if (r <= 0) eof = true;
+            else end += (size_t)r;
+            return;
+        }
+    }
+
+    // Next line without its '\n'; the view is valid until the next read.
+    bool nextLine(const char*& p, size_t& n) {
+        while (true) {
+            const char* start = buf.data() + pos;
+            const char* nl = (const char*)std::memchr(start, '\n', end - pos);
+            if (nl) {
+                p = start;
+                n = nl - start;
+                pos += n + 1;
+                return true;
+            }
+            if (eof) {
+                if (pos == end) return false;
+                p = start;
+                n = end - pos;
+                pos = end;
+                return true;
+            }
+            fill();
+        }
+    }
+
+    // Next whitespace-delimited token.
+    bool nextToken(const char*& p, size_t& n) {
+        auto space = [](char c) { return c == ' ' || c == '\n' || c == '\t' || c == '\r'; };
+        while (true) {
+            while (pos < end && space(buf[pos])) ++pos;
+            if (pos < end) break;
+            if (eof) return false;
+            fill();
+        }
+        size_t i = pos;
+        while (true) {
+            while (i < end && !space(buf[i])) ++i;
+            if (i < end || eof) break;
+            size_t offset = i - pos;
+            fill();
+            i = pos + offset;
+        }
+        p = buf.data() + pos;
+        n = i - pos;
+        pos = i;
+        return true;
+    }
+};
+inline RoxIn rox_in;
+
+// read_line: reads one line from stdin
+inline rox_result<RoxString> read_line() {
+    const char* p;
+    size_t n;
+    if (!rox_in.nextLine(p, n)) return error<RoxString>("EOF");
+    return ok(RoxString(std::string(p, n)));
+}
+
+template<typename T>
+rox_result<T> rox_read_number(const char* invalid) {
+    const char* p;
+    size_t n;
+    if (!rox_in.nextToken(p, n)) return error<T>("EOF");
+    T v{};
+    auto [last, ec] = std::from_chars(p, p + n, v);
+    if (ec != std::errc() || last != p + n) return error<T>(invalid);
+    return ok(v);
+}
+inline rox_result<int64_t> read_int64() { return rox_read_number<int64_t>("Invalid int64"); }
+inline rox_result<double> read_float64() { return rox_read_number<double>("Invalid float64"); }
+
+// A line of stdin viewed in place; converts to string when stored.
+struct RoxLine {
+    const char* ptr;
+    size_t len;
+    int64_t size() const { return (int64_t)len; }
+    operator RoxString() const { return RoxString(std::string(ptr, len)); }
+    bool operator==(const RoxString& s) const { return s.val.size() == len && std::memcmp(ptr, s.val.data(), len) == 0; }
+    bool operator!=(const RoxString& s) const { return !(*this == s); }
+};
+inline void rox_write(const RoxLine& s) { rox_out.put(s.ptr, s.len); }
+inline rox_result<char> rox_at(const RoxLine& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.ptr[i]);
+}
+inline rox_result<char> rox_at_unchecked(const RoxLine& s, int64_t i) {
+    return {s.ptr[i], RoxString()};
+}
+
+struct RoxStdinLines {
+    struct Iterator {
+        RoxLine line;
+        bool done;
+        Iterator& operator++() { done = !rox_in.nextLine(line.ptr, line.len); return *this; }
+        const RoxLine& operator*() const { return line; }
+        bool operator!=(const Iterator& other) const { return done != other.done; }
+    };
+    Iterator begin() { Iterator it{{nullptr, 0}, false}; return ++it; }
+    Iterator end() { return {{nullptr, 0}, true}; }
+};
+inline RoxStdinLines stdin_lines() { return {}; }
+
+
+// End Runtime
+
@@ -0,0 +1,475 @@
+#pragma once
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+#include <memory_resource>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+inline const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+inline RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+inline std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+inline RoxOut rox_out;
+inline void rox_flush_stdout() { rox_out.flush(); }
+
+inline void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+inline void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+inline void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+inline void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+inline void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+inline void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// Block-scoped arena for lists and dictionaries that never leave their block.
+// The first 1 KiB comes from the stack; everything is released when the block exits.
+struct RoxArena : std::pmr::monotonic_buffer_resource {
+    alignas(std::max_align_t) std::byte buffer[1024];
+    RoxArena() : std::pmr::monotonic_buffer_resource(buffer, sizeof buffer) {}
+};
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+inline rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+inline rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+// Dictionary Hash for RoxString
+namespace std {
+    template <> struct hash<RoxString> {
+        size_t operator()(const RoxString& s) const {
+            return hash<string>()(s.val);
+        }
+    };
+}
+
+// Dictionary Access
+template<typename K, typename V, typename H, typename E, typename A>
+rox_result<V> rox_get(const std::unordered_map<K, V, H, E, A>& dict, K key) {
+    auto it = dict.find(key);
+    if (it == dict.end()) return error<V>("Key not found");
+    return ok(it->second);
+}
+
+// Dictionary Set
+template<typename K, typename V, typename H, typename E, typename A>
+void rox_set(std::unordered_map<K, V, H, E, A>& dict, K key, V val) {
+    dict.insert_or_assign(key, val);
+}
+
+// Dictionary Remove
+template<typename K, typename V, typename H, typename E, typename A>
+void rox_remove(std::unordered_map<K, V, H, E, A>& dict, K key) {
+    dict.erase(key);
+}
+
+// Dictionary Has
+template<typename K, typename V, typename H, typename E, typename A>
+bool rox_has(const std::unordered_map<K, V, H, E, A>& dict, K key) {
+    return dict.find(key) != dict.end();
+}
+
+// Dictionary Keys
+template<typename K, typename V, typename H, typename E, typename A>
+std::vector<K> rox_keys(const std::unordered_map<K, V, H, E, A>& dict) {
+    std::vector<K> keys;
+    keys.reserve(dict.size());
+    for (const auto& kv : dict) {
+        keys.push_back(kv.first);
+    }
+    return keys;
+}
+
+
+// Sorting: pattern-defeating quicksort for general element types,
+// LSD radix sort for int64 / float64 / char.
+template<typename T>
+void rox_insertion_sort(T* first, T* last) {
+    if (first == last) return;
+    for (T* cur = first + 1; cur != last; ++cur) {
+        if (*cur < *(cur - 1)) {
+            T tmp = std::move(*cur);
+            T* sift = cur;
+            do { *sift = std::move(*(sift - 1)); --sift; } while (sift != first && tmp < *(sift - 1));
+            *sift = std::move(tmp);
+        }
+    }
+}
+
+// Gives up after a fixed number of moves; used to finish nearly sorted partitions cheaply.
+template<typename T>
+bool rox_partial_insertion_sort(T* first, T* last) {
+    if (first == last) return true;
+    size_t moves = 0;
+    for (T* cur = first + 1; cur != last; ++cur) {
+        if (*cur < *(cur - 1)) {
+            T tmp = std::move(*cur);
+            T* sift = cur;
+            do { *sift = std::move(*(sift - 1)); --sift; } while (sift != first && tmp < *(sift - 1));
+            *sift = std::move(tmp);
+            moves += cur - sift;
+            if (moves > 8) return false;
+        }
+    }
+    return true;
+}
+
+template<typename T>
+void rox_sort3(T* a, T* b, T* c) {
+    if (*b < *a) std::swap(*a, *b);
+    if (*c < *b) std::swap(*b, *c);
+    if (*b < *a) std::swap(*a, *b);
+}
+
+// Partitions [first, last) around *first; elements equal to the pivot go right.
+// Returns the pivot position and whether the range was already partitioned.
+template<typename T>
+std::pair<T*, bool> rox_partition_right(T* first, T* last) {
+    T pivot = std::move(*first);
+    T* lo = first;
+    T* hi = last;
+    while (*++lo < pivot) {}
+    if (lo - 1 == first) { while (lo < hi && !(*--hi < pivot)) {} }
+    else { while (!(*--hi < pivot)) {} }
+    bool already = lo >= hi;
+    while (lo < hi) {
+        std::swap(*lo, *hi);
+        while (*++lo < pivot) {}
+        while (!(*--hi < pivot)) {}
+    }
+    T* pos = lo - 1;
+    *first = std::move(*pos);
+    *pos = std::move(pivot);
+    return {pos, already};
+}
+
+// Partitions with elements equal to the pivot going left; used when the pivot
+// equals the element before the range, which means the whole run of equal keys is skipped.
+template<typename T>
+T* rox_partition_left(T* first, T* last) {
+    T pivot = std::move(*first);
+    T* lo = first;
+    T* hi = last;
+    while (pivot < *--hi) {}
+    if (hi + 1 == last) { while (lo < hi && !(pivot < *++lo)) {} }
+    else { while (!(pivot < *++lo)) {} }
+    while (lo < hi) {
+        std::swap(*lo, *hi);
+        while (pivot < *--hi) {}
+        while (!(pivot < *++lo)) {}
+    }
+    T* pos = hi;
+    *first = std::move(*pos);
+    *pos = std::move(pivot);
+    return pos;
+}
+
+template<typename T>
+void rox_pdqsort_loop(T* first, T* last, int badAllowed, bool leftmost) {
+    while (true) {
+        size_t n = last - first;
+        if (n < 24) { rox_insertion_sort(first, last); return; }
+
+        // Median of three, or Tukey's ninther for large ranges; the median lands on *first.
+        size_t half = n / 2;
+        if (n > 128) {
+            rox_sort3(first, first + half, last - 1);
+            rox_sort3(first + 1, first + (half - 1), last - 2);
+            rox_sort3(first + 2, first + (half + 1), last - 3);
+            rox_sort3(first + (half - 1), first + half, first + (half + 1));
+            std::swap(*first, *(first + half));
+        } else {
+            rox_sort3(first + half, first, last - 1);
+        }
+
+        if (!leftmost && !(*(first - 1) < *first)) {
+            first = rox_partition_left(first, last) + 1;
+            continue;
+        }
+
+        auto [pivot, already] = rox_partition_right(first, last);
+        size_t lsize = pivot - first;
+        size_t rsize = last - (pivot + 1);
+        bool unbalanced = lsize < n / 8 || rsize < n / 8;
+
+        if (unbalanced) {
+            if (--badAllowed == 0) {
+                std::make_heap(first, last);
+                std::sort_heap(first, last);
+                return;
+            }
+            // Break up patterns that produced the bad split.
+            if (lsize >= 24) {
+                std::swap(*first, *(first + lsize / 4));
+                std::swap(*(pivot - 1), *(pivot - lsize / 4));
+            }
+            if (rsize >= 24) {
+                std::swap(*(pivot + 1), *(pivot + 1 + rsize / 4));
+                std::swap(*(last - 1), *(last - rsize / 4));
+            }
+        } else if (already && rox_partial_insertion_sort(first, pivot) && rox_partial_insertion_sort(pivot + 1, last)) {
+            return;
+        }
+
+        rox_pdqsort_loop(first, pivot, badAllowed, leftmost);
+        first = pivot + 1;
+        leftmost = false;
+    }
+}
+
+template<typename T>
+void rox_pdqsort(T* first, T* last) {
+    size_t n = last - first;
+    int log2n = 1;
+    while (n >>= 1) ++log2n;
+    rox_pdqsort_loop(first, last, log2n, true);
+}
+
+// LSD radix sort over order-preserving unsigned keys. Passes whose byte is the
+// same for every key are skipped.
+template<typename T, typename A, typename KeyFn>
+void rox_radix_sort(std::vector<T, A>& xs, KeyFn key) {
+    size_t n = xs.size();
+    if (n < 256) { rox_pdqsort(xs.data(), xs.data() + n); return; }
+    using K = decltype(key(xs[0]));
+    constexpr int bits = sizeof(K) > 1 ? 11 : 8;
+    constexpr int radix = 1 << bits;
+    constexpr int passes = (sizeof(K) * 8 + bits - 1) / bits;
+    std::vector<size_t> counts(passes * radix, 0);
+    for (const T& x : xs) {
+        K k = key(x);
+        for (int p = 0; p < passes; ++p) counts[p * radix + ((k >> (bits * p)) & (radix - 1))]++;
+    }
+    std::vector<T> buffer(n);
+    T* src = xs.data();
+    T* dst = buffer.data();
+    for (int p = 0; p < passes; ++p) {
+        size_t* c = &counts[p * radix];
+        K first = (key(src[0]) >> (bits * p)) & (radix - 1);
+        if (c[first] == n) continue;
+        size_t sum = 0;
+        for (int b = 0; b < radix; ++b) { size_t t = c[b]; c[b] = sum; sum += t; }
+        for (size_t i = 0; i < n; ++i) dst[c[(key(src[i]) >> (bits * p)) & (radix - 1)]++] = src[i];
+        std::swap(src, dst);
+    }
+    if (src != xs.data()) std::copy(src, src + n, xs.data());
+}
+
+inline uint64_t rox_radix_key(int64_t x) { return (uint64_t)x ^ (1ull << 63); }
+inline uint64_t rox_radix_key(double x) {
+    uint64_t bits;
+    std::memcpy(&bits, &x, sizeof bits);
+    return (bits & (1ull << 63)) ? ~bits : bits | (1ull << 63);
+}
+inline uint8_t rox_radix_key(char x) { return (uint8_t)((unsigned char)x ^ (std::is_signed_v<char> ? 0x80 : 0)); }
+
+template<typename T, typename A>
+void rox_sort(std::vector<T, A>& xs) {
+    rox_pdqsort(xs.data(), xs.data() + xs.size());
+}
+template<typename A>
+void rox_sort(std::vector<int64_t, A>& xs) {
+    rox_radix_sort(xs, [](int64_t x) { return rox_radix_key(x); });
+}
+template<typename A>
+void rox_sort(std::vector<double, A>& xs) {
+    rox_radix_sort(xs, [](double x) { return rox_radix_key(x); });
+}
+template<typename A>
+void rox_sort(std::vector<char, A>& xs) {
+    size_t counts[256] = {0};
+    for (char c : xs) counts[rox_radix_key(c)]++;
+    size_t i = 0;
+    for (int b = 0; b < 256; ++b) {
+        for (size_t k = 0; k < counts[b]; ++k) xs[i++] = (char)(unsigned char)(b ^ (std::is_signed_v<char> ? 0x80 : 0));
+    }
+}
+template<typename A>
+void rox_sort(std::vector<bool, A>& xs) {
+    size_t falses = 0;
+    for (bool b : xs) falses += !b;
+    for (size_t i = 0; i < xs.size(); ++i) xs[i] = i >= falses;
+}
+
+// sort_by: stable sort of a copy by keys computed once per element. Radix-sortable
+// keys sort (key, index) pairs, which LSD radix keeps stable; other keys sort an
+// index permutation with std::stable_sort.
+template<typename K>
+struct RoxKeyed { K key; uint32_t index; bool operator<(const RoxKeyed& o) const { return key < o.key; } };
+
+template<typename T, typename F>
+std::vector<T> sort_by(const std::vector<T>& xs, F keyFn) {
+    using K = std::decay_t<decltype(keyFn(xs[0]))>;
+    std::vector<RoxKeyed<K>> keyed;
+    keyed.reserve(xs.size());
+    for (size_t i = 0; i < xs.size(); ++i) keyed.push_back({keyFn(xs[i]), (uint32_t)i});
+    if constexpr (std::is_same_v<K, int64_t> || std::is_same_v<K, double> || std::is_same_v<K, char>) {
+        if (keyed.size() >= 256) rox_radix_sort(keyed, [](const RoxKeyed<K>& k) { return rox_radix_key(k.key); });
+        else std::stable_sort(keyed.begin(), keyed.end());
+    } else {
+        std::stable_sort(keyed.begin(), keyed.end());
+    }
+    std::vector<T> sorted;
+    sorted.reserve(xs.size());
+    for (const auto& k : keyed) sorted.push_back(xs[k.index]);
+    return sorted;
+}
+
+
+// End Runtime
+
+int64_t roxv26_most_common(std::vector<int64_t> roxv26_xs);
+std::vector<int64_t> roxv26_evens(int64_t roxv26_n);
+
@@ -0,0 +1,278 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+#include <memory_resource>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// Block-scoped arena for lists and dictionaries that never leave their block.
+// The first 1 KiB comes from the stack; everything is released when the block exits.
+struct RoxArena : std::pmr::monotonic_buffer_resource {
+    alignas(std::max_align_t) std::byte buffer[1024];
+    RoxArena() : std::pmr::monotonic_buffer_resource(buffer, sizeof buffer) {}
+};
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+
+// End Runtime
+
+int64_t roxv26_sum_list(std::vector<int64_t> roxv26_xs);
+int64_t roxv26_count_char(RoxString roxv26_s, char roxv26_target);
+int64_t roxv26_pairs_below(std::vector<int64_t> roxv26_xs, int64_t roxv26_limit);
+int64_t roxv26_cross_sum(std::vector<std::vector<int64_t>> roxv26_grid);
+
+int64_t roxv26_sum_list(std::vector<int64_t> roxv26_xs) {
+  int64_t roxv26_total = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)roxv26_xs.size()); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    rox_result<int64_t> roxv26_r = rox_at_unchecked(roxv26_xs, roxv26_i);
+    if (true)     {
+      (roxv26_total = (roxv26_total + roxv26_r.value));
+    }
+  }
+  return roxv26_total;
+}
+int64_t roxv26_count_char(RoxString roxv26_s, char roxv26_target) {
+  int64_t roxv26_n = ((int64_t)roxv26_s.size());
+  int64_t roxv26_count = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = roxv26_n; roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    rox_result<char> roxv26_r = rox_at_unchecked(roxv26_s, roxv26_i);
+    if ((!true))     {
+      return (-((int64_t)1));
+    }
+    if ((roxv26_r.value == roxv26_target))     {
+      (roxv26_count = (roxv26_count + ((int64_t)1)));
+    }
+  }
+  return roxv26_count;
+}
+int64_t roxv26_pairs_below(std::vector<int64_t> roxv26_xs, int64_t roxv26_limit) {
+  int64_t roxv26_n = ((int64_t)roxv26_xs.size());
+  int64_t roxv26_count = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = roxv26_n; roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    for (int64_t roxv26_j = (roxv26_i + ((int64_t)1)), roxv26__end1 = roxv26_n; roxv26_j < roxv26__end1; roxv26_j += ((int64_t)1))     {
+      rox_result<int64_t> roxv26_a = rox_at_unchecked(roxv26_xs, roxv26_i);
+      rox_result<int64_t> roxv26_b = rox_at_unchecked(roxv26_xs, roxv26_j);
+      if ((true && true))       {
+        if (((roxv26_a.value + roxv26_b.value) < roxv26_limit))         {
+          (roxv26_count = (roxv26_count + ((int64_t)1)));
+        }
+      }
+    }
+  }
+  return roxv26_count;
+}
+int64_t roxv26_cross_sum(std::vector<std::vector<int64_t>> roxv26_grid) {
+  int64_t roxv26_total = ((int64_t)0);
+  for (auto roxv26_a : roxv26_grid)   {
+    for (auto roxv26_b : roxv26_grid)     {
+      for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)roxv26_a.size()); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))       {
+        rox_result<int64_t> roxv26_r = rox_at(roxv26_b, roxv26_i);
+        if (isOk(roxv26_r))         {
+          (roxv26_total = (roxv26_total + getValue(roxv26_r)));
+        }
+        else         {
+          (roxv26_total = (roxv26_total + ((int64_t)1000000)));
+        }
+      }
+    }
+  }
+  return roxv26_total;
+}
+int main() {
+  RoxArena roxv26__arena;
+  std::vector<int64_t> roxv26_xs = std::vector<int64_t>{((int64_t)3), ((int64_t)1), ((int64_t)4), ((int64_t)1), ((int64_t)5), ((int64_t)9), ((int64_t)2), ((int64_t)6)};
+  print(roxv26_sum_list(roxv26_xs), rox_str("\n"));
+  print(roxv26_count_char(rox_str("mississippi"), 's'), rox_str("\n"));
+  print(roxv26_pairs_below(roxv26_xs, ((int64_t)5)), rox_str("\n"));
+  int64_t roxv26_misses = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = (((int64_t)roxv26_xs.size()) + ((int64_t)1)); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    rox_result<int64_t> roxv26_r = rox_at(roxv26_xs, roxv26_i);
+    if ((!isOk(roxv26_r)))     {
+      (roxv26_misses = (roxv26_misses + ((int64_t)1)));
+    }
+  }
+  print(roxv26_misses, rox_str("\n"));
+  std::pmr::vector<int64_t> roxv26_grow({((int64_t)1), ((int64_t)2)}, &roxv26__arena);
+  int64_t roxv26_seen = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end1 = ((int64_t)roxv26_grow.size()); roxv26_i < roxv26__end1; roxv26_i += ((int64_t)1))   {
+    rox_result<int64_t> roxv26_r = rox_at(roxv26_grow, roxv26_i);
+    if (isOk(roxv26_r))     {
+      (roxv26_seen = (roxv26_seen + getValue(roxv26_r)));
+    }
+  }
+  roxv26_grow.push_back(((int64_t)3));
+  print(roxv26_seen, rox_str(" "), ((int64_t)roxv26_grow.size()), rox_str("\n"));
+  std::vector<std::vector<int64_t>> roxv26_grid = std::vector<std::vector<int64_t>>{std::vector{((int64_t)1), ((int64_t)2), ((int64_t)3), ((int64_t)4), ((int64_t)5), ((int64_t)6), ((int64_t)7), ((int64_t)8)}, std::vector{((int64_t)1)}};
+  print(roxv26_cross_sum(roxv26_grid), rox_str("\n"));
+  return 0;
+}
@@ -0,0 +1,195 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+
+// Division
+template<typename T>
+rox_result<T> rox_div(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a / b);
+}
+
+// Modulo
+template<typename T>
+rox_result<T> rox_mod(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a % b);
+}
+
+// Division and modulo by a divisor proven nonzero at compile time
+template<typename T>
+rox_result<T> rox_div_unchecked(T a, T b) {
+    return {a / b, RoxString()};
+}
+template<typename T>
+rox_result<T> rox_mod_unchecked(T a, T b) {
+    return {a % b, RoxString()};
+}
+
+rox_result<double> float64_sqrt(double x) {
+    if (x < 0) return error<double>("Negative input for sqrt");
+    return ok(std::sqrt(x));
+}
+
+
+// End Runtime
+
+int64_t roxv26_scale(int64_t roxv26_KB);
+
+const int64_t roxv26_KB = ((int64_t)1024);
+const int64_t roxv26_DAY = ((int64_t)86400);
+int64_t roxv26_scale(int64_t roxv26_KB) {
+  return (roxv26_KB * ((int64_t)2));
+}
+int main() {
+  print(((int64_t)86400), rox_str("\n"));
+  int64_t roxv26_total = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)10240); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    (roxv26_total = (roxv26_total + ((int64_t)1)));
+  }
+  print(roxv26_total, rox_str("\n"));
+  const int64_t roxv26_N = ((int64_t)1000);
+  rox_result<int64_t> roxv26_quarter = ok(((int64_t)250));
+  print(roxv26_quarter.value, rox_str("\n"));
+  rox_result<int64_t> roxv26_rem = ok(((int64_t)7));
+  if (true)   {
+    print(roxv26_rem.value, rox_str("\n"));
+  }
+  rox_result<int64_t> roxv26_bad = rox_div(((int64_t)1000), ((int64_t)0));
+  if ((!isOk(roxv26_bad)))   {
+    print(getError(roxv26_bad), rox_str("\n"));
+  }
+  print(((int64_t)7), rox_str(" "), (-((int64_t)8)), rox_str("\n"));
+  print(6.0, rox_str(" "), 0.30000000000000004, rox_str("\n"));
+  print(true, rox_str(" "), false, rox_str(" "), true, rox_str("\n"));
+  print(((int64_t)5), rox_str(" "), ((int64_t)9), rox_str(" "), ((int64_t)1024), rox_str("\n"));
+  print(2.0, rox_str(" "), 1.4142135623730951, rox_str("\n"));
+  rox_result<double> roxv26_root = ok(4.0);
+  print(roxv26_root.value, rox_str("\n"));
+  rox_result<double> roxv26_neg = float64_sqrt((-1.0));
+  print(isOk(roxv26_neg), rox_str("\n"));
+  print(roxv26_scale(((int64_t)5)), rox_str("\n"));
+  int64_t roxv26_N2 = ((int64_t)1000);
+  (roxv26_N2 = (roxv26_N2 + ((int64_t)1)));
+  print(roxv26_N2, rox_str("\n"));
+  return 0;
+}
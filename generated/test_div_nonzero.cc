@@ -0,0 +1,265 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+
+// Division
+template<typename T>
+rox_result<T> rox_div(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a / b);
+}
+
+// Modulo
+template<typename T>
+rox_result<T> rox_mod(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a % b);
+}
+
+// Division and modulo by a divisor proven nonzero at compile time
+template<typename T>
+rox_result<T> rox_div_unchecked(T a, T b) {
+    return {a / b, RoxString()};
+}
+template<typename T>
+rox_result<T> rox_mod_unchecked(T a, T b) {
+    return {a % b, RoxString()};
+}
+
+
+// List reductions: hand-vectorized kernels with runtime AVX2 / SSE dispatch.
+// Floating-point kernels use the same 4-lane association on every path,
+// so results do not depend on the CPU the program runs on.
+#if defined(__x86_64__) || defined(__i386__)
+#define ROX_X86 1
+#include <immintrin.h>
+#endif
+
+#if ROX_X86
+bool rox_has_avx2() {
+    static const bool has = __builtin_cpu_supports("avx2");
+    return has;
+}
+bool rox_has_sse42() {
+    static const bool has = __builtin_cpu_supports("sse4.2");
+    return has;
+}
+#endif
+
+// int64_sum: wrapping addition, like the scalar loop in practice
+int64_t rox_sum_i64_scalar(const int64_t* p, size_t n) {
+    uint64_t s = 0;
+    for (size_t i = 0; i < n; ++i) s += (uint64_t)p[i];
+    return (int64_t)s;
+}
+#if ROX_X86
+__attribute__((target("avx2")))
+int64_t rox_sum_i64_avx2(const int64_t* p, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) acc = _mm256_add_epi64(acc, _mm256_loadu_si256((const __m256i*)(p + i)));
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256((__m256i*)lanes, acc);
+    uint64_t s = (uint64_t)lanes[0] + (uint64_t)lanes[1] + (uint64_t)lanes[2] + (uint64_t)lanes[3];
+    return (int64_t)(s + (uint64_t)rox_sum_i64_scalar(p + i, n - i));
+}
+int64_t rox_sum_i64_sse2(const int64_t* p, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) acc = _mm_add_epi64(acc, _mm_loadu_si128((const __m128i*)(p + i)));
+    alignas(16) int64_t lanes[2];
+    _mm_store_si128((__m128i*)lanes, acc);
+    uint64_t s = (uint64_t)lanes[0] + (uint64_t)lanes[1];
+    return (int64_t)(s + (uint64_t)rox_sum_i64_scalar(p + i, n - i));
+}
+#endif
+int64_t int64_sum(const std::vector<int64_t>& xs) {
+#if ROX_X86
+    if (rox_has_avx2()) return rox_sum_i64_avx2(xs.data(), xs.size());
+    return rox_sum_i64_sse2(xs.data(), xs.size());
+#else
+    return rox_sum_i64_scalar(xs.data(), xs.size());
+#endif
+}
+
+
+// End Runtime
+
+int64_t roxv26_average(std::vector<int64_t> roxv26_xs);
+double roxv26_safe_ratio(double roxv26_a, double roxv26_b);
+int64_t roxv26_digits(int64_t roxv26_x, int64_t roxv26_base);
+
+int64_t roxv26_average(std::vector<int64_t> roxv26_xs) {
+  int64_t roxv26_n = ((int64_t)roxv26_xs.size());
+  if ((roxv26_n == ((int64_t)0)))   {
+    return ((int64_t)0);
+  }
+  rox_result<int64_t> roxv26_avg = rox_div_unchecked(int64_sum(roxv26_xs), roxv26_n);
+  return roxv26_avg.value;
+}
+double roxv26_safe_ratio(double roxv26_a, double roxv26_b) {
+  if ((!(roxv26_b == 0.0)))   {
+    rox_result<double> roxv26_r = rox_div_unchecked(roxv26_a, roxv26_b);
+    return roxv26_r.value;
+  }
+  return 0.0;
+}
+int64_t roxv26_digits(int64_t roxv26_x, int64_t roxv26_base) {
+  if ((roxv26_base > ((int64_t)1)))   {
+    int64_t roxv26_count = ((int64_t)1);
+    int64_t roxv26_rest = (roxv26_x / roxv26_base);
+    for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)64); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))     {
+      if ((roxv26_rest == ((int64_t)0)))       {
+        break;
+      }
+      (roxv26_count = (roxv26_count + ((int64_t)1)));
+      (roxv26_rest = (roxv26_rest / roxv26_base));
+    }
+    return roxv26_count;
+  }
+  return (-((int64_t)1));
+}
+int main() {
+  int64_t roxv26_lo = ((int64_t)3);
+  int64_t roxv26_hi = ((int64_t)17);
+  rox_result<int64_t> roxv26_mid = rox_div_unchecked((roxv26_lo + roxv26_hi), ((int64_t)2));
+  print(roxv26_mid.value, rox_str("\n"));
+  int64_t roxv26_total = ((int64_t)0);
+  for (int64_t roxv26_d = ((int64_t)1), roxv26__end0 = ((int64_t)6); roxv26_d < roxv26__end0; roxv26_d += ((int64_t)1))   {
+    rox_result<int64_t> roxv26_r = rox_mod_unchecked(((int64_t)60), roxv26_d);
+    (roxv26_total = (roxv26_total + roxv26_r.value));
+  }
+  print(roxv26_total, rox_str("\n"));
+  for (int64_t roxv26_d = (-((int64_t)1)), roxv26__end1 = (-((int64_t)4)); roxv26_d > roxv26__end1; roxv26_d += (-((int64_t)1)))   {
+    (roxv26_total = (roxv26_total + (((int64_t)7) / roxv26_d)));
+  }
+  print(roxv26_total, rox_str("\n"));
+  std::vector<int64_t> roxv26_none_yet = std::vector<int64_t>{};
+  print(roxv26_average(std::vector{((int64_t)4), ((int64_t)8), ((int64_t)12)}), rox_str(" "), roxv26_average(roxv26_none_yet), rox_str("\n"));
+  print(roxv26_safe_ratio(3.0, 4.0), rox_str(" "), roxv26_safe_ratio(1.0, 0.0), rox_str("\n"));
+  print(roxv26_digits(((int64_t)12345), ((int64_t)10)), rox_str(" "), roxv26_digits(((int64_t)255), ((int64_t)16)), rox_str(" "), roxv26_digits(((int64_t)1), ((int64_t)1)), rox_str("\n"));
+  int64_t roxv26_z = ((int64_t)5);
+  (roxv26_z = (roxv26_z - ((int64_t)5)));
+  rox_result<int64_t> roxv26_bad = rox_div(((int64_t)10), roxv26_z);
+  if ((!isOk(roxv26_bad)))   {
+    print(getError(roxv26_bad), rox_str("\n"));
+  }
+  return 0;
+}
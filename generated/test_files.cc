@@ -0,0 +1,347 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <memory>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <cstdlib>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+// A line of stdin viewed in place; converts to string when stored.
+struct RoxLine {
+    const char* ptr;
+    size_t len;
+    int64_t size() const { return (int64_t)len; }
+    operator RoxString() const { return RoxString(std::string(ptr, len)); }
+    bool operator==(const RoxString& s) const { return s.val.size() == len && std::memcmp(ptr, s.val.data(), len) == 0; }
+    bool operator!=(const RoxString& s) const { return !(*this == s); }
+};
+void rox_write(const RoxLine& s) { rox_out.put(s.ptr, s.len); }
+rox_result<char> rox_at(const RoxLine& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.ptr[i]);
+}
+rox_result<char> rox_at_unchecked(const RoxLine& s, int64_t i) {
+    return {s.ptr[i], RoxString()};
+}
+
+// Files
+rox_result<RoxString> read_file(const RoxString& path) {
+    int fd = ::open(path.val.c_str(), O_RDONLY);
+    if (fd < 0) return error<RoxString>(std::strerror(errno));
+    std::string data;
+    struct stat st;
+    if (::fstat(fd, &st) == 0 && st.st_size > 0) data.reserve((size_t)st.st_size);
+    char chunk[1 << 16];
+    while (true) {
+        ssize_t r = ::read(fd, chunk, sizeof chunk);
+        if (r < 0 && errno == EINTR) continue;
+        if (r < 0) { int err = errno; ::close(fd); return error<RoxString>(std::strerror(err)); }
+        if (r == 0) break;
+        data.append(chunk, (size_t)r);
+    }
+    ::close(fd);
+    return ok(RoxString(std::move(data)));
+}
+
+// file_view: a read-only memory mapping. Copies and slices share the mapping,
+// which is unmapped when the last of them goes away.
+struct RoxFileView {
+    std::shared_ptr<const char> mapping;
+    const char* ptr = nullptr;
+    size_t len = 0;
+
+    int64_t size() const { return (int64_t)len; }
+    operator RoxString() const { return RoxString(std::string(ptr, len)); }
+    bool operator==(const RoxString& s) const { return s.val.size() == len && std::memcmp(ptr, s.val.data(), len) == 0; }
+    bool operator!=(const RoxString& s) const { return !(*this == s); }
+
+    rox_result<RoxFileView> slice(int64_t start, int64_t end) const {
+        if (start < 0 || end < start || end > size()) return error<RoxFileView>("Index out of bounds");
+        return ok(RoxFileView{mapping, ptr + start, (size_t)(end - start)});
+    }
+
+    struct Lines {
+        std::shared_ptr<const char> mapping; // keeps a temporary view's file mapped during the loop
+        const char* begin_;
+        const char* end_;
+        struct Iterator {
+            const char* next;
+            const char* end;
+            RoxLine line;
+            bool done;
+            Iterator& operator++() {
+                if (next == end) { done = true; return *this; }
+                const char* nl = (const char*)std::memchr(next, '\n', end - next);
+                const char* stop = nl ? nl : end;
+                line = {next, (size_t)(stop - next)};
+                next = nl ? nl + 1 : end;
+                return *this;
+            }
+            const RoxLine& operator*() const { return line; }
+            bool operator!=(const Iterator& other) const { return done != other.done; }
+        };
+        Iterator begin() const { Iterator it{begin_, end_, {nullptr, 0}, false}; return ++it; }
+        Iterator end() const { return {end_, end_, {nullptr, 0}, true}; }
+    };
+    Lines lines() const { return {mapping, ptr, ptr + len}; }
+};
+void rox_write(const RoxFileView& v) { rox_out.put(v.ptr, v.len); }
+rox_result<char> rox_at(const RoxFileView& v, int64_t i) {
+    if (i < 0 || i >= v.size()) return error<char>("Index out of bounds");
+    return ok(v.ptr[i]);
+}
+rox_result<char> rox_at_unchecked(const RoxFileView& v, int64_t i) {
+    return {v.ptr[i], RoxString()};
+}
+
+rox_result<RoxFileView> map_file(const RoxString& path) {
+    int fd = ::open(path.val.c_str(), O_RDONLY);
+    if (fd < 0) return error<RoxFileView>(std::strerror(errno));
+    struct stat st;
+    if (::fstat(fd, &st) != 0) { int err = errno; ::close(fd); return error<RoxFileView>(std::strerror(err)); }
+    size_t len = (size_t)st.st_size;
+    if (len == 0) { ::close(fd); return ok(RoxFileView{}); }
+    void* addr = ::mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    int err = errno;
+    ::close(fd);
+    if (addr == MAP_FAILED) return error<RoxFileView>(std::strerror(err));
+    ::madvise(addr, len, MADV_SEQUENTIAL);
+    std::shared_ptr<const char> mapping((const char*)addr, [len](const char* p) { ::munmap((void*)p, len); });
+    return ok(RoxFileView{mapping, (const char*)addr, len});
+}
+
+// End Runtime
+
+int64_t roxv26_count_char(RoxFileView roxv26_f, char roxv26_c);
+RoxFileView roxv26_load();
+
+int64_t roxv26_count_char(RoxFileView roxv26_f, char roxv26_c) {
+  int64_t roxv26_n = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)roxv26_f.size()); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    rox_result<char> roxv26_ch = rox_at_unchecked(roxv26_f, roxv26_i);
+    if ((roxv26_ch.value == roxv26_c))     {
+      (roxv26_n = (roxv26_n + ((int64_t)1)));
+    }
+  }
+  return roxv26_n;
+}
+RoxFileView roxv26_load() {
+  return getValue(map_file(rox_str("test/test_files.data")));
+}
+int main() {
+  rox_result<RoxString> roxv26_text = read_file(rox_str("test/test_files.data"));
+  if (isOk(roxv26_text))   {
+    print(rox_str("read "), ((int64_t)getValue(roxv26_text).size()), rox_str(" bytes\n"));
+  }
+  rox_result<RoxString> roxv26_missing = read_file(rox_str("test/no_such_file.data"));
+  if ((!isOk(roxv26_missing)))   {
+    print(rox_str("missing: "), getError(roxv26_missing), rox_str("\n"));
+  }
+  rox_result<RoxFileView> roxv26_mapped = map_file(rox_str("test/test_files.data"));
+  if (isOk(roxv26_mapped))   {
+    RoxFileView roxv26_f = getValue(roxv26_mapped);
+    print(rox_str("mapped "), ((int64_t)roxv26_f.size()), rox_str(" bytes, "), roxv26_count_char(roxv26_f, 'a'), rox_str(" a's\n"));
+    for (auto roxv26_line : roxv26_f.lines())     {
+      print(rox_str("["), roxv26_line, rox_str("]\n"));
+    }
+    rox_result<RoxFileView> roxv26_word = roxv26_f.slice(((int64_t)8), ((int64_t)12));
+    if (isOk(roxv26_word))     {
+      RoxFileView roxv26_w = getValue(roxv26_word);
+      print(rox_str("slice: "), roxv26_w, rox_str(" "), ((int64_t)roxv26_w.size()), rox_str("\n"));
+      if ((roxv26_w == rox_str("beta")))       {
+        print(rox_str("slice matches\n"));
+      }
+      RoxString roxv26_copy = roxv26_w;
+      print(rox_str("copied: "), roxv26_copy, rox_str("\n"));
+    }
+    rox_result<RoxFileView> roxv26_bad = roxv26_f.slice(((int64_t)5), ((int64_t)100));
+    if ((!isOk(roxv26_bad)))     {
+      print(rox_str("slice error: "), getError(roxv26_bad), rox_str("\n"));
+    }
+    rox_result<char> roxv26_last = rox_at(roxv26_f, (((int64_t)roxv26_f.size()) - ((int64_t)1)));
+    if (isOk(roxv26_last))     {
+      print(rox_str("last: "), getValue(roxv26_last), rox_str("\n"));
+    }
+  }
+  for (auto roxv26_line : roxv26_load().lines())   {
+    print(rox_str("temporary: "), roxv26_line, rox_str("\n"));
+  }
+  rox_result<RoxFileView> roxv26_none_mapped = map_file(rox_str("test/no_such_file.data"));
+  if ((!isOk(roxv26_none_mapped)))   {
+    print(rox_str("map error: "), getError(roxv26_none_mapped), rox_str("\n"));
+  }
+  return 0;
+}
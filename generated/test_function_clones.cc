@@ -0,0 +1,269 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+#include <utility>
+#include <memory_resource>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// Function values: ROX functions are top-level and never capture, so a
+// function-typed value is a plain pointer.
+template<typename F>
+using RoxFn = F*;
+
+// A function known at compile time, passed to a callback parameter. Its type names
+// the function, so each callee is instantiated with a direct, inlinable call.
+template<auto F>
+struct RoxKnownFn {
+    template<typename... A>
+    decltype(auto) operator()(A&&... a) const { return F(std::forward<A>(a)...); }
+    constexpr operator decltype(F)() const { return F; }
+};
+
+// Block-scoped arena for lists and dictionaries that never leave their block.
+// The first 1 KiB comes from the stack; everything is released when the block exits.
+struct RoxArena : std::pmr::monotonic_buffer_resource {
+    alignas(std::max_align_t) std::byte buffer[1024];
+    RoxArena() : std::pmr::monotonic_buffer_resource(buffer, sizeof buffer) {}
+};
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+
+// End Runtime
+
+struct Op {
+  RoxString roxv26_name;
+  RoxFn<int64_t(int64_t, int64_t)> roxv26_f;
+};
+
+int64_t roxv26_add(int64_t roxv26_a, int64_t roxv26_b);
+int64_t roxv26_mul(int64_t roxv26_a, int64_t roxv26_b);
+int64_t roxv26_negate(int64_t roxv26_x);
+template<typename roxv26__F3, typename roxv26__F4>
+int64_t roxv26_fold(std::vector<int64_t> roxv26_xs, int64_t roxv26_i, int64_t roxv26_acc, roxv26__F3 roxv26_f, roxv26__F4 roxv26_g);
+template<typename roxv26__F0>
+int64_t roxv26_twice(roxv26__F0 roxv26_g, int64_t roxv26_x);
+template<typename roxv26__F0>
+int64_t roxv26_run(roxv26__F0 roxv26_h, int64_t roxv26_x);
+
+int64_t roxv26_add(int64_t roxv26_a, int64_t roxv26_b) {
+  return (roxv26_a + roxv26_b);
+}
+int64_t roxv26_mul(int64_t roxv26_a, int64_t roxv26_b) {
+  return (roxv26_a * roxv26_b);
+}
+int64_t roxv26_negate(int64_t roxv26_x) {
+  return (((int64_t)0) - roxv26_x);
+}
+template<typename roxv26__F3, typename roxv26__F4>
+int64_t roxv26_fold(std::vector<int64_t> roxv26_xs, int64_t roxv26_i, int64_t roxv26_acc, roxv26__F3 roxv26_f, roxv26__F4 roxv26_g) {
+  if ((roxv26_i == ((int64_t)roxv26_xs.size())))   {
+    return roxv26_acc;
+  }
+  rox_result<int64_t> roxv26_x = rox_at(roxv26_xs, roxv26_i);
+  if (isOk(roxv26_x))   {
+    return roxv26_fold(roxv26_xs, (roxv26_i + ((int64_t)1)), roxv26_f(roxv26_acc, roxv26_g(getValue(roxv26_x))), roxv26_f, roxv26_g);
+  }
+  return roxv26_acc;
+}
+template<typename roxv26__F0>
+int64_t roxv26_twice(roxv26__F0 roxv26_g, int64_t roxv26_x) {
+  return roxv26_g(roxv26_g(roxv26_x));
+}
+template<typename roxv26__F0>
+int64_t roxv26_run(roxv26__F0 roxv26_h, int64_t roxv26_x) {
+  return roxv26_h(roxv26_negate, roxv26_x);
+}
+int main() {
+  RoxArena roxv26__arena;
+  std::vector<int64_t> roxv26_xs = std::vector<int64_t>{((int64_t)1), ((int64_t)2), ((int64_t)3), ((int64_t)4)};
+  print(roxv26_fold(roxv26_xs, ((int64_t)0), ((int64_t)0), RoxKnownFn<&roxv26_add>{}, RoxKnownFn<&roxv26_negate>{}), rox_str("\n"));
+  print(roxv26_fold(roxv26_xs, ((int64_t)0), ((int64_t)1), RoxKnownFn<&roxv26_mul>{}, RoxKnownFn<&roxv26_negate>{}), rox_str("\n"));
+  RoxFn<int64_t(int64_t, int64_t)> roxv26_op = roxv26_mul;
+  print(roxv26_fold(roxv26_xs, ((int64_t)0), ((int64_t)1), roxv26_op, RoxKnownFn<&roxv26_negate>{}), rox_str("\n"));
+  (roxv26_op = roxv26_add);
+  print(roxv26_fold(roxv26_xs, ((int64_t)0), ((int64_t)0), roxv26_op, RoxKnownFn<&roxv26_negate>{}), rox_str("\n"));
+  print(roxv26_run(RoxKnownFn<&roxv26_twice<RoxFn<int64_t(int64_t)>>>{}, ((int64_t)5)), rox_str("\n"));
+  RoxFn<int64_t(RoxFn<int64_t(int64_t)>, int64_t)> roxv26_t = roxv26_twice<RoxFn<int64_t(int64_t)>>;
+  print(roxv26_t(roxv26_negate, ((int64_t)7)), rox_str("\n"));
+  std::pmr::vector<Op> roxv26_ops({Op{.roxv26_name = rox_str("add"), .roxv26_f = roxv26_add}, Op{.roxv26_name = rox_str("mul"), .roxv26_f = roxv26_mul}}, &roxv26__arena);
+  for (auto roxv26_o : roxv26_ops)   {
+    RoxFn<int64_t(int64_t, int64_t)> roxv26_f = roxv26_o.roxv26_f;
+    print(roxv26_o.roxv26_name, rox_str(" "), roxv26_f(((int64_t)6), ((int64_t)7)), rox_str("\n"));
+  }
+  std::pmr::vector<RoxFn<int64_t(int64_t)>> roxv26_fs({roxv26_negate}, &roxv26__arena);
+  for (auto roxv26_g : roxv26_fs)   {
+    print(roxv26_twice(roxv26_g, ((int64_t)9)), rox_str("\n"));
+  }
+  return 0;
+}
@@ -0,0 +1,585 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <functional>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <limits>
+#include <cstdlib>
+#include <deque>
+#include <iterator>
+#include <utility>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// Function values: ROX functions are top-level and never capture, so a
+// function-typed value is a plain pointer.
+template<typename F>
+using RoxFn = F*;
+
+// A function known at compile time, passed to a callback parameter. Its type names
+// the function, so each callee is instantiated with a direct, inlinable call.
+template<auto F>
+struct RoxKnownFn {
+    template<typename... A>
+    decltype(auto) operator()(A&&... a) const { return F(std::forward<A>(a)...); }
+    constexpr operator decltype(F)() const { return F; }
+};
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+// Division
+template<typename T>
+rox_result<T> rox_div(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a / b);
+}
+
+// Modulo
+template<typename T>
+rox_result<T> rox_mod(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a % b);
+}
+
+// Division and modulo by a divisor proven nonzero at compile time
+template<typename T>
+rox_result<T> rox_div_unchecked(T a, T b) {
+    return {a / b, RoxString()};
+}
+template<typename T>
+rox_result<T> rox_mod_unchecked(T a, T b) {
+    return {a % b, RoxString()};
+}
+
+
+// Set while running a parallel loop chunk or a task; parallel loops started there run serially.
+thread_local bool rox_in_parallel = false;
+// Index of the pool slot owned by this thread (0 for the main thread).
+thread_local int rox_worker = 0;
+
+// A spawned task. state goes 0 (queued) -> 1 (claimed) -> 2 (done); whoever claims it
+// runs it: a pool worker, or the thread that joins it before anyone else got to it.
+struct RoxTaskBase {
+    std::atomic<int> state{0};
+    virtual ~RoxTaskBase() = default;
+    virtual void execute() = 0;
+    bool claim() {
+        int expected = 0;
+        return state.compare_exchange_strong(expected, 1);
+    }
+    void runClaimed() {
+        bool outer = rox_in_parallel;
+        rox_in_parallel = true;
+        execute();
+        rox_in_parallel = outer;
+        state.store(2);
+        state.notify_all();
+    }
+};
+
+// Parallel loops and tasks: a work-stealing pool of ROX_THREADS workers (default: one
+// per hardware thread). The calling thread works too. For loops, each worker owns a
+// contiguous range of chunk indices, takes from its front and steals from the back of
+// others. Spawned tasks go on the spawning thread's deque: the owner pops the newest,
+// thieves take the oldest.
+class RoxPool {
+public:
+    explicit RoxPool(int workers) : slots(workers) {
+        for (int w = 1; w < workers; ++w) std::thread([this, w] { workerLoop(w); }).detach();
+    }
+    int size() const { return (int)slots.size(); }
+
+    // Runs task(c) for every c in [0, chunks) and returns when all have finished.
+    void run(int64_t chunks, const std::function<void(int64_t)>& task) {
+        int64_t lo = 0;
+        for (int w = 0; w < size(); ++w) {
+            int64_t hi = lo + chunks / size() + (w < chunks % size() ? 1 : 0);
+            std::lock_guard<std::mutex> guard(slots[w].m);
+            slots[w].lo = lo;
+            slots[w].hi = hi;
+            lo = hi;
+        }
+        pending.store(chunks);
+        {
+            std::lock_guard<std::mutex> lock(m);
+            current = &task;
+            ++generation;
+        }
+        wake.notify_all();
+        work(0, task);
+        std::unique_lock<std::mutex> lock(m);
+        finished.wait(lock, [&] { return pending.load() == 0 && busy == 0; });
+        current = nullptr;
+    }
+
+    void submit(std::shared_ptr<RoxTaskBase> task) {
+        {
+            Slot& own = slots[rox_worker];
+            std::lock_guard<std::mutex> guard(own.m);
+            own.tasks.push_back(std::move(task));
+        }
+        queued.fetch_add(1);
+        // Only pay for a wakeup when a worker is actually asleep.
+        if (sleeping.load() > 0) {
+            std::lock_guard<std::mutex> lock(m);
+            wake.notify_one();
+        }
+    }
+
+    // Runs other tasks while waiting for target to finish.
+    void helpUntil(RoxTaskBase& target) {
+        std::shared_ptr<RoxTaskBase> task;
+        while (target.state.load() != 2) {
+            if (takeTask(rox_worker, task)) {
+                if (task->claim()) task->runClaimed();
+                task.reset();
+            } else {
+                target.state.wait(1);
+            }
+        }
+    }
+
+    // Drops tasks that join() already ran from the newest end of this thread's deque.
+    // Nothing else would pop them when no worker steals, e.g. with ROX_THREADS=1.
+    void discardClaimed() {
+        Slot& own = slots[rox_worker];
+        std::lock_guard<std::mutex> guard(own.m);
+        while (!own.tasks.empty() && own.tasks.back()->state.load() != 0) {
+            own.tasks.pop_back();
+            queued.fetch_sub(1);
+        }
+    }
+
+private:
+    struct alignas(64) Slot {
+        std::mutex m;
+        int64_t lo = 0, hi = 0;
+        std::deque<std::shared_ptr<RoxTaskBase>> tasks;
+    };
+    std::vector<Slot> slots;
+    std::mutex m;
+    std::condition_variable wake, finished;
+    const std::function<void(int64_t)>* current = nullptr;
+    uint64_t generation = 0;
+    int busy = 0;
+    std::atomic<int64_t> pending{0};
+    std::atomic<int64_t> queued{0};
+    std::atomic<int> sleeping{0};
+
+    bool take(int self, int64_t& chunk) {
+        {
+            Slot& own = slots[self];
+            std::lock_guard<std::mutex> guard(own.m);
+            if (own.lo < own.hi) { chunk = own.lo++; return true; }
+        }
+        for (int i = 1; i < size(); ++i) {
+            Slot& victim = slots[(self + i) % size()];
+            std::lock_guard<std::mutex> guard(victim.m);
+            if (victim.lo < victim.hi) { chunk = --victim.hi; return true; }
+        }
+        return false;
+    }
+    void work(int self, const std::function<void(int64_t)>& task) {
+        int64_t chunk;
+        while (take(self, chunk)) {
+            task(chunk);
+            pending.fetch_sub(1);
+        }
+    }
+    bool takeTask(int self, std::shared_ptr<RoxTaskBase>& task) {
+        if (queued.load() == 0) return false;
+        {
+            Slot& own = slots[self];
+            std::lock_guard<std::mutex> guard(own.m);
+            if (!own.tasks.empty()) {
+                task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        for (int i = 1; i < size(); ++i) {
+            Slot& victim = slots[(self + i) % size()];
+            std::lock_guard<std::mutex> guard(victim.m);
+            if (!victim.tasks.empty()) {
+                task = std::move(victim.tasks.front());
+                victim.tasks.pop_front();
+                queued.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+    void workerLoop(int self) {
+        rox_worker = self;
+        uint64_t seen = 0;
+        std::shared_ptr<RoxTaskBase> spawned;
+        while (true) {
+            const std::function<void(int64_t)>* task = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m);
+                ++sleeping;
+                wake.wait(lock, [&] { return generation != seen || queued.load() > 0; });
+                --sleeping;
+                if (generation != seen) {
+                    seen = generation;
+                    task = current; // null if that loop already finished
+                    if (task) ++busy;
+                }
+            }
+            if (task) {
+                work(self, *task);
+                {
+                    std::lock_guard<std::mutex> lock(m);
+                    --busy;
+                }
+                finished.notify_all();
+            }
+            while (takeTask(self, spawned)) {
+                if (spawned->claim()) spawned->runClaimed();
+                spawned.reset();
+            }
+        }
+    }
+};
+
+// Never destroyed: a runtime error may exit() from inside a worker.
+RoxPool& rox_pool() {
+    static RoxPool* pool = [] {
+        const char* env = std::getenv("ROX_THREADS");
+        int n = env ? std::atoi(env) : 0;
+        if (n <= 0) n = (int)std::thread::hardware_concurrency();
+        return new RoxPool(n > 0 ? n : 1);
+    }();
+    return *pool;
+}
+
+// Chunking depends only on the trip count: at most 4096 chunks.
+int64_t rox_parallel_grain(int64_t n) { return n <= 4096 ? 1 : (n + 4095) / 4096; }
+int64_t rox_parallel_chunks(int64_t n) { return n <= 0 ? 0 : (n + rox_parallel_grain(n) - 1) / rox_parallel_grain(n); }
+
+template<typename T> T rox_min_identity() { return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max(); }
+template<typename T> T rox_max_identity() { return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest(); }
+
+// Calls body(chunk, lo, hi) over [0, n). Nested parallel loops run serially.
+template<typename F>
+void rox_parallel_for(int64_t n, F body) {
+    const int64_t grain = rox_parallel_grain(n);
+    const int64_t chunks = rox_parallel_chunks(n);
+    auto runChunk = [&](int64_t c) { body(c, c * grain, std::min(n, (c + 1) * grain)); };
+    if (chunks <= 1 || rox_in_parallel || rox_pool().size() == 1) {
+        for (int64_t c = 0; c < chunks; ++c) runChunk(c);
+        return;
+    }
+    rox_pool().run(chunks, [&](int64_t c) {
+        rox_in_parallel = true;
+        runChunk(c);
+        rox_in_parallel = false;
+    });
+}
+
+// parallel_map / parallel_filter / parallel_reduce: list builtins on the same pool and
+// chunking as parallel for. Short lists run serially. Output order always matches
+// the input order.
+constexpr int64_t rox_parallel_min_size = 4096;
+
+template<typename T, typename F>
+auto parallel_map(const std::vector<T>& xs, F fn) {
+    using R = std::decay_t<decltype(fn(xs[0]))>;
+    const int64_t n = (int64_t)xs.size();
+    // vector<bool> packs bits, so neighbouring chunks would race on shared words.
+    using Slot = std::conditional_t<std::is_same_v<R, bool>, char, R>;
+    std::vector<Slot> out(n);
+    if (n < rox_parallel_min_size) {
+        for (int64_t i = 0; i < n; ++i) out[i] = fn(xs[i]);
+    } else {
+        rox_parallel_for(n, [&](int64_t, int64_t lo, int64_t hi) {
+            for (int64_t i = lo; i < hi; ++i) out[i] = fn(xs[i]);
+        });
+    }
+    if constexpr (std::is_same_v<R, bool>) return std::vector<bool>(out.begin(), out.end());
+    else return out;
+}
+
+template<typename T, typename F>
+std::vector<T> parallel_filter(const std::vector<T>& xs, F pred) {
+    const int64_t n = (int64_t)xs.size();
+    std::vector<T> out;
+    if (n < rox_parallel_min_size) {
+        for (const T& x : xs) if (pred(x)) out.push_back(x);
+        return out;
+    }
+    std::vector<std::vector<T>> kept(rox_parallel_chunks(n));
+    rox_parallel_for(n, [&](int64_t c, int64_t lo, int64_t hi) {
+        for (int64_t i = lo; i < hi; ++i) if (pred(xs[i])) kept[c].push_back(xs[i]);
+    });
+    size_t total = 0;
+    for (const auto& k : kept) total += k.size();
+    out.reserve(total);
+    for (auto& k : kept) out.insert(out.end(), std::make_move_iterator(k.begin()), std::make_move_iterator(k.end()));
+    return out;
+}
+
+// combine must be associative: each chunk folds its own elements, then init and the
+// chunk results are folded left to right. Chunk results are combined like elements,
+// so init, combine's parameters and its result all have the element type.
+template<typename T, typename F>
+T parallel_reduce(const std::vector<T>& xs, std::type_identity_t<T> init, F combine) {
+    const int64_t n = (int64_t)xs.size();
+    if (n < rox_parallel_min_size) {
+        for (const T& x : xs) init = combine(init, x);
+        return init;
+    }
+    std::vector<T> partial(rox_parallel_chunks(n));
+    rox_parallel_for(n, [&](int64_t c, int64_t lo, int64_t hi) {
+        T acc = xs[lo];
+        for (int64_t i = lo + 1; i < hi; ++i) acc = combine(acc, xs[i]);
+        partial[c] = acc;
+    });
+    for (const T& p : partial) init = combine(init, p);
+    return init;
+}
+
+
+// End Runtime
+
+int64_t roxv26_square(int64_t roxv26_x);
+bool roxv26_is_even(int64_t roxv26_x);
+int64_t roxv26_add(int64_t roxv26_a, int64_t roxv26_b);
+char roxv26_first_digit(RoxString roxv26_s);
+
+int64_t roxv26_square(int64_t roxv26_x) {
+  return (roxv26_x * roxv26_x);
+}
+bool roxv26_is_even(int64_t roxv26_x) {
+  rox_result<int64_t> roxv26_r = rox_mod_unchecked(roxv26_x, ((int64_t)2));
+  if (true)   {
+    return (roxv26_r.value == ((int64_t)0));
+  }
+  return false;
+}
+int64_t roxv26_add(int64_t roxv26_a, int64_t roxv26_b) {
+  return (roxv26_a + roxv26_b);
+}
+char roxv26_first_digit(RoxString roxv26_s) {
+  rox_result<char> roxv26_c = rox_at(roxv26_s, ((int64_t)0));
+  if (isOk(roxv26_c))   {
+    return getValue(roxv26_c);
+  }
+  return 'x';
+}
+int main() {
+  std::vector<int64_t> roxv26_xs = std::vector<int64_t>{};
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)100000); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    roxv26_xs.push_back(roxv26_i);
+  }
+  std::vector<int64_t> roxv26_squares = parallel_map(roxv26_xs, RoxKnownFn<&roxv26_square>{});
+  std::vector<int64_t> roxv26_evens = parallel_filter(roxv26_xs, RoxKnownFn<&roxv26_is_even>{});
+  int64_t roxv26_total = parallel_reduce(roxv26_xs, ((int64_t)0), RoxKnownFn<&roxv26_add>{});
+  int64_t roxv26_square_total = parallel_reduce(roxv26_squares, ((int64_t)0), RoxKnownFn<&roxv26_add>{});
+  print(((int64_t)roxv26_squares.size()), rox_str(" "), ((int64_t)roxv26_evens.size()), rox_str(" "), roxv26_total, rox_str(" "), roxv26_square_total, rox_str("\n"));
+  bool roxv26_ordered = true;
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end1 = ((int64_t)roxv26_evens.size()); roxv26_i < roxv26__end1; roxv26_i += ((int64_t)1))   {
+    rox_result<int64_t> e = rox_at_unchecked(roxv26_evens, roxv26_i);
+    if (true)     {
+      if ((!(e.value == (((int64_t)2) * roxv26_i))))       {
+        (roxv26_ordered = false);
+      }
+    }
+  }
+  rox_result<int64_t> roxv26_last = rox_at(roxv26_squares, ((int64_t)99999));
+  if (isOk(roxv26_last))   {
+    print(roxv26_ordered, rox_str(" "), getValue(roxv26_last), rox_str("\n"));
+  }
+  std::vector<bool> roxv26_flags = parallel_map(roxv26_xs, RoxKnownFn<&roxv26_is_even>{});
+  int64_t roxv26_trues = ((int64_t)0);
+  for (auto roxv26_f : roxv26_flags)   {
+    if (roxv26_f)     {
+      (roxv26_trues = (roxv26_trues + ((int64_t)1)));
+    }
+  }
+  print(roxv26_trues, rox_str("\n"));
+  std::vector<RoxString> roxv26_words = std::vector<RoxString>{rox_str("apple"), rox_str("banana"), rox_str("cherry")};
+  std::vector<char> roxv26_initials = parallel_map(roxv26_words, RoxKnownFn<&roxv26_first_digit>{});
+  for (auto roxv26_c : roxv26_initials)   {
+    print(roxv26_c);
+  }
+  print(rox_str("\n"));
+  std::vector<int64_t> roxv26_empty = std::vector<int64_t>{};
+  print(parallel_reduce(roxv26_empty, ((int64_t)7), RoxKnownFn<&roxv26_add>{}), rox_str(" "), ((int64_t)parallel_filter(roxv26_empty, RoxKnownFn<&roxv26_is_even>{}).size()), rox_str("\n"));
+  return 0;
+}
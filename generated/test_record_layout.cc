@@ -0,0 +1,294 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+#include <memory_resource>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// Block-scoped arena for lists and dictionaries that never leave their block.
+// The first 1 KiB comes from the stack; everything is released when the block exits.
+struct RoxArena : std::pmr::monotonic_buffer_resource {
+    alignas(std::max_align_t) std::byte buffer[1024];
+    RoxArena() : std::pmr::monotonic_buffer_resource(buffer, sizeof buffer) {}
+};
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+
+// End Runtime
+
+struct User {
+  int64_t roxv26_id;
+  RoxString roxv26_name;
+  double roxv26_score;
+  bool roxv26_active;
+  char roxv26_initial;
+  bool roxv26_admin;
+};
+
+struct Wrapper {
+  User roxv26_user;
+  bool roxv26_flag;
+  char roxv26_tag;
+};
+
+struct Bag {
+  std::vector<int64_t> roxv26_items;
+  int64_t roxv26_count;
+  bool roxv26_full;
+};
+
+struct RoxSoa_User {
+  using record_type = User;
+  std::vector<bool> roxv26_active;
+  std::vector<int64_t> roxv26_id;
+  std::vector<char> roxv26_initial;
+  std::vector<RoxString> roxv26_name;
+  std::vector<bool> roxv26_admin;
+  std::vector<double> roxv26_score;
+  size_t count = 0;
+  RoxSoa_User() = default;
+  RoxSoa_User(std::initializer_list<User> items) { for (const auto& r : items) push_back(r); }
+  size_t size() const { return count; }
+  void push_back(const User& r) {
+    roxv26_active.push_back(r.roxv26_active);
+    roxv26_id.push_back(r.roxv26_id);
+    roxv26_initial.push_back(r.roxv26_initial);
+    roxv26_name.push_back(r.roxv26_name);
+    roxv26_admin.push_back(r.roxv26_admin);
+    roxv26_score.push_back(r.roxv26_score);
+    ++count;
+  }
+  void pop_back() {
+    if (count == 0) return;
+    roxv26_active.pop_back();
+    roxv26_id.pop_back();
+    roxv26_initial.pop_back();
+    roxv26_name.pop_back();
+    roxv26_admin.pop_back();
+    roxv26_score.pop_back();
+    --count;
+  }
+  User operator[](size_t i) const { return User{.roxv26_id = roxv26_id[i], .roxv26_name = roxv26_name[i], .roxv26_score = roxv26_score[i], .roxv26_active = roxv26_active[i], .roxv26_initial = roxv26_initial[i], .roxv26_admin = roxv26_admin[i]}; }
+  void assign(size_t i, const User& r) {
+    roxv26_active[i] = r.roxv26_active;
+    roxv26_id[i] = r.roxv26_id;
+    roxv26_initial[i] = r.roxv26_initial;
+    roxv26_name[i] = r.roxv26_name;
+    roxv26_admin[i] = r.roxv26_admin;
+    roxv26_score[i] = r.roxv26_score;
+  }
+  struct iterator {
+    const RoxSoa_User* list;
+    size_t i;
+    User operator*() const { return (*list)[i]; }
+    iterator& operator++() { ++i; return *this; }
+    bool operator!=(const iterator& other) const { return i != other.i; }
+  };
+  iterator begin() const { return {this, 0}; }
+  iterator end() const { return {this, count}; }
+};
+
+int64_t roxv26_next_id();
+RoxString roxv26_label();
+bool roxv26_flag(bool roxv26_b);
+
+int64_t roxv26_next_id() {
+  print(rox_str("next_id\n"));
+  return ((int64_t)7);
+}
+RoxString roxv26_label() {
+  print(rox_str("label\n"));
+  return rox_str("x");
+}
+bool roxv26_flag(bool roxv26_b) {
+  print(rox_str("flag\n"));
+  return roxv26_b;
+}
+User roxv26_first = []() { bool roxv26__f0_0 = roxv26_flag(true); int64_t roxv26__f0_1 = roxv26_next_id(); char roxv26__f0_2 = 'g'; RoxString roxv26__f0_3 = roxv26_label(); bool roxv26__f0_4 = false; double roxv26__f0_5 = 0.5; return User{.roxv26_id = std::move(roxv26__f0_1), .roxv26_name = std::move(roxv26__f0_3), .roxv26_score = std::move(roxv26__f0_5), .roxv26_active = std::move(roxv26__f0_0), .roxv26_initial = std::move(roxv26__f0_2), .roxv26_admin = std::move(roxv26__f0_4)}; }();
+int main() {
+  RoxArena roxv26__arena;
+  print(roxv26_first.roxv26_id, rox_str(" "), roxv26_first.roxv26_initial, rox_str("\n"));
+  Bag roxv26_b = [&]() { bool roxv26__f0_0 = roxv26_flag(false); std::vector<int64_t> roxv26__f0_1{}; int64_t roxv26__f0_2 = roxv26_next_id(); return Bag{.roxv26_items = std::move(roxv26__f0_1), .roxv26_count = std::move(roxv26__f0_2), .roxv26_full = std::move(roxv26__f0_0)}; }();
+  print(((int64_t)roxv26_b.roxv26_items.size()), rox_str(" "), roxv26_b.roxv26_count, rox_str("\n"));
+  User roxv26_u = [&]() { bool roxv26__f1_0 = true; int64_t roxv26__f1_1 = roxv26_next_id(); char roxv26__f1_2 = 'q'; RoxString roxv26__f1_3 = roxv26_label(); bool roxv26__f1_4 = false; double roxv26__f1_5 = 1.5; return User{.roxv26_id = std::move(roxv26__f1_1), .roxv26_name = std::move(roxv26__f1_3), .roxv26_score = std::move(roxv26__f1_5), .roxv26_active = std::move(roxv26__f1_0), .roxv26_initial = std::move(roxv26__f1_2), .roxv26_admin = std::move(roxv26__f1_4)}; }();
+  Wrapper roxv26_w = Wrapper{.roxv26_user = roxv26_u, .roxv26_flag = true, .roxv26_tag = 't'};
+  print(roxv26_u.roxv26_id, rox_str(" "), roxv26_u.roxv26_name, rox_str(" "), roxv26_u.roxv26_initial, rox_str(" "), roxv26_w.roxv26_user.roxv26_score, rox_str(" "), roxv26_w.roxv26_tag, rox_str("\n"));
+  std::pmr::vector<User> roxv26_us({roxv26_u, User{}}, &roxv26__arena);
+  print(((int64_t)roxv26_us.size()), rox_str("\n"));
+  RoxSoa_User roxv26_su = RoxSoa_User{roxv26_u};
+  rox_result<User> roxv26_back = rox_at(roxv26_su, ((int64_t)0));
+  if (isOk(roxv26_back))   {
+    print(getValue(roxv26_back).roxv26_name, rox_str("\n"));
+  }
+  return 0;
+}
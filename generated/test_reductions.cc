@@ -0,0 +1,572 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
+#include <charconv>
+#include <cerrno>
+#include <unistd.h>
+#include <cstdlib>
+
+// ROX Runtime
+void rox_flush_stdout();
+using rox_char = char;
+using rox_bool = bool;
+struct None { bool operator==(const None&) const { return true; } };
+const None none = {};
+
+    // Helper for string literals
+class RoxString {
+public:
+    std::string val;
+    RoxString(const char* s) : val(s) {}
+    RoxString(std::string s) : val(std::move(s)) {}
+    RoxString() = default;
+
+    int64_t size() const { return (int64_t)val.size(); }
+    bool operator==(const RoxString& other) const { return val == other.val; }
+    bool operator!=(const RoxString& other) const { return val != other.val; }
+    bool operator<(const RoxString& other) const { return val < other.val; }
+};
+
+std::ostream& operator<<(std::ostream& os, const RoxString& s) {
+    return os << s.val;
+}
+
+RoxString rox_str(const char* s) {
+    return RoxString(s);
+}
+template<typename T>
+struct rox_result {
+    T value;
+    RoxString err;
+};
+template<typename T>
+bool isOk(rox_result<T> r) {
+    return r.err.val.empty();
+}
+template<typename T>
+T getValue(rox_result<T> r) {
+    if (!r.err.val.empty()) {
+        rox_flush_stdout();
+        std::cerr << "Runtime Error: " << r.err.val << std::endl;
+        exit(1);
+    }
+    return r.value;
+}
+template<typename T>
+RoxString getError(rox_result<T> r) {
+    return r.err;
+}
+// Result constructors
+template<typename T>
+rox_result<T> ok(T value) { return {value, RoxString("")}; }
+template<typename T>
+rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }
+
+// I/O
+std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {
+    for (char c : s) os << c;
+    return os;
+}
+
+// Buffered stdout: print() formats into a user-space buffer that is written with
+// write(2) when full, at exit, before reading stdin, and before any runtime error.
+struct RoxOut {
+    static constexpr size_t capacity = 1 << 16;
+    char buf[capacity];
+    size_t len = 0;
+    ~RoxOut() { flush(); }
+    void flush() { writeAll(buf, len); len = 0; }
+    static void writeAll(const char* p, size_t n) {
+        while (n > 0) {
+            ssize_t w = ::write(1, p, n);
+            if (w < 0 && errno == EINTR) continue;
+            if (w <= 0) return;
+            p += w;
+            n -= (size_t)w;
+        }
+    }
+    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }
+    void put(const char* s, size_t n) {
+        if (n > capacity / 2) { flush(); writeAll(s, n); return; }
+        std::memcpy(reserve(n), s, n);
+        len += n;
+    }
+};
+RoxOut rox_out;
+void rox_flush_stdout() { rox_out.flush(); }
+
+void rox_write(int64_t v) {
+    char* p = rox_out.reserve(24);
+    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;
+}
+// Same text as iostream's default float format (%g, 6 significant digits)
+void rox_write(double v) {
+    char* p = rox_out.reserve(32);
+    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;
+}
+void rox_write(bool v) { v ? rox_out.put("true", 4) : rox_out.put("false", 5); }
+void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }
+void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }
+void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }
+
+template<typename... Args>
+None print(const Args&... args) {
+    (rox_write(args), ...);
+    return none;
+}
+
+
+// List access (any allocator: arena-backed lists are std::pmr::vector)
+template<typename T, typename A>
+rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<T>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+// List Set
+template<typename T, typename A>
+void rox_set(std::vector<T, A>& xs, int64_t i, T val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs[i] = val;
+}
+
+// Unchecked list access: only emitted where range analysis proved the index in bounds
+template<typename T, typename A>
+rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+// soa_list access: SoA containers name their record_type and rebuild records on read
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at(const S& xs, int64_t i) {
+    if (i < 0 || i >= (int64_t)xs.size()) return error<R>("Index out of bounds");
+    return ok(xs[i]);
+}
+
+template<typename S, typename R = typename S::record_type>
+rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {
+    return {xs[i], RoxString()};
+}
+
+template<typename S, typename R = typename S::record_type>
+void rox_set(S& xs, int64_t i, typename S::record_type val) {
+    if (i < 0 || i >= (int64_t)xs.size()) {
+        rox_flush_stdout();
+        std::cerr << "Error: Index out of bounds in list.set" << std::endl;
+        exit(1);
+    }
+    xs.assign(i, val);
+}
+
+// String access
+rox_result<char> rox_at(const RoxString& s, int64_t i) {
+    if (i < 0 || i >= s.size()) return error<char>("Index out of bounds");
+    return ok(s.val[i]);
+}
+
+rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {
+    return {s.val[i], RoxString()};
+}
+
+
+// Division
+template<typename T>
+rox_result<T> rox_div(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a / b);
+}
+
+// Modulo
+template<typename T>
+rox_result<T> rox_mod(T a, T b) {
+    if (b == 0) return error<T>("Division by zero");
+    return ok(a % b);
+}
+
+// Division and modulo by a divisor proven nonzero at compile time
+template<typename T>
+rox_result<T> rox_div_unchecked(T a, T b) {
+    return {a / b, RoxString()};
+}
+template<typename T>
+rox_result<T> rox_mod_unchecked(T a, T b) {
+    return {a % b, RoxString()};
+}
+
+double float64_abs(double x) { return std::abs(x); }
+double float64_max(double x, double y) { return std::max(x, y); }
+
+// List reductions: hand-vectorized kernels with runtime AVX2 / SSE dispatch.
+// Floating-point kernels use the same 4-lane association on every path,
+// so results do not depend on the CPU the program runs on.
+#if defined(__x86_64__) || defined(__i386__)
+#define ROX_X86 1
+#include <immintrin.h>
+#endif
+
+#if ROX_X86
+bool rox_has_avx2() {
+    static const bool has = __builtin_cpu_supports("avx2");
+    return has;
+}
+bool rox_has_sse42() {
+    static const bool has = __builtin_cpu_supports("sse4.2");
+    return has;
+}
+#endif
+
+// int64_sum: wrapping addition, like the scalar loop in practice
+int64_t rox_sum_i64_scalar(const int64_t* p, size_t n) {
+    uint64_t s = 0;
+    for (size_t i = 0; i < n; ++i) s += (uint64_t)p[i];
+    return (int64_t)s;
+}
+#if ROX_X86
+__attribute__((target("avx2")))
+int64_t rox_sum_i64_avx2(const int64_t* p, size_t n) {
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) acc = _mm256_add_epi64(acc, _mm256_loadu_si256((const __m256i*)(p + i)));
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256((__m256i*)lanes, acc);
+    uint64_t s = (uint64_t)lanes[0] + (uint64_t)lanes[1] + (uint64_t)lanes[2] + (uint64_t)lanes[3];
+    return (int64_t)(s + (uint64_t)rox_sum_i64_scalar(p + i, n - i));
+}
+int64_t rox_sum_i64_sse2(const int64_t* p, size_t n) {
+    __m128i acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) acc = _mm_add_epi64(acc, _mm_loadu_si128((const __m128i*)(p + i)));
+    alignas(16) int64_t lanes[2];
+    _mm_store_si128((__m128i*)lanes, acc);
+    uint64_t s = (uint64_t)lanes[0] + (uint64_t)lanes[1];
+    return (int64_t)(s + (uint64_t)rox_sum_i64_scalar(p + i, n - i));
+}
+#endif
+int64_t int64_sum(const std::vector<int64_t>& xs) {
+#if ROX_X86
+    if (rox_has_avx2()) return rox_sum_i64_avx2(xs.data(), xs.size());
+    return rox_sum_i64_sse2(xs.data(), xs.size());
+#else
+    return rox_sum_i64_scalar(xs.data(), xs.size());
+#endif
+}
+
+// int64_list_min / int64_list_max
+int64_t rox_minmax_i64_scalar(const int64_t* p, size_t n, bool wantMax) {
+    int64_t m = p[0];
+    for (size_t i = 1; i < n; ++i) m = wantMax ? (p[i] > m ? p[i] : m) : (p[i] < m ? p[i] : m);
+    return m;
+}
+#if ROX_X86
+__attribute__((target("avx2")))
+int64_t rox_minmax_i64_avx2(const int64_t* p, size_t n, bool wantMax) {
+    if (n < 4) return rox_minmax_i64_scalar(p, n, wantMax);
+    __m256i m = _mm256_loadu_si256((const __m256i*)p);
+    size_t i = 4;
+    for (; i + 4 <= n; i += 4) {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+        __m256i gt = wantMax ? _mm256_cmpgt_epi64(v, m) : _mm256_cmpgt_epi64(m, v);
+        m = _mm256_blendv_epi8(m, v, gt);
+    }
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256((__m256i*)lanes, m);
+    int64_t r = rox_minmax_i64_scalar(lanes, 4, wantMax);
+    if (i < n) {
+        int64_t t = rox_minmax_i64_scalar(p + i, n - i, wantMax);
+        r = wantMax ? (t > r ? t : r) : (t < r ? t : r);
+    }
+    return r;
+}
+__attribute__((target("sse4.2")))
+int64_t rox_minmax_i64_sse42(const int64_t* p, size_t n, bool wantMax) {
+    if (n < 2) return rox_minmax_i64_scalar(p, n, wantMax);
+    __m128i m = _mm_loadu_si128((const __m128i*)p);
+    size_t i = 2;
+    for (; i + 2 <= n; i += 2) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i gt = wantMax ? _mm_cmpgt_epi64(v, m) : _mm_cmpgt_epi64(m, v);
+        m = _mm_blendv_epi8(m, v, gt);
+    }
+    alignas(16) int64_t lanes[2];
+    _mm_store_si128((__m128i*)lanes, m);
+    int64_t r = rox_minmax_i64_scalar(lanes, 2, wantMax);
+    if (i < n) {
+        int64_t t = rox_minmax_i64_scalar(p + i, n - i, wantMax);
+        r = wantMax ? (t > r ? t : r) : (t < r ? t : r);
+    }
+    return r;
+}
+#endif
+int64_t rox_minmax_i64(const std::vector<int64_t>& xs, bool wantMax) {
+#if ROX_X86
+    if (rox_has_avx2()) return rox_minmax_i64_avx2(xs.data(), xs.size(), wantMax);
+    if (rox_has_sse42()) return rox_minmax_i64_sse42(xs.data(), xs.size(), wantMax);
+#endif
+    return rox_minmax_i64_scalar(xs.data(), xs.size(), wantMax);
+}
+rox_result<int64_t> int64_list_min(const std::vector<int64_t>& xs) {
+    if (xs.empty()) return error<int64_t>("Empty list");
+    return ok(rox_minmax_i64(xs, false));
+}
+rox_result<int64_t> int64_list_max(const std::vector<int64_t>& xs) {
+    if (xs.empty()) return error<int64_t>("Empty list");
+    return ok(rox_minmax_i64(xs, true));
+}
+
+// float64 kernels: 4 lanes, lane j takes elements i with i % 4 == j,
+// combined as (l0 + l1) + (l2 + l3), then the tail is added in order.
+double rox_lanes_f64(const double* l) { return (l[0] + l[1]) + (l[2] + l[3]); }
+
+// mode 0: plain lanes, mode 1: Kahan-compensated lanes; b == nullptr sums a, otherwise sums a[i] * b[i]
+double rox_sum_f64_scalar(const double* a, const double* b, size_t n, int mode) {
+    double s[4] = {0, 0, 0, 0}, c[4] = {0, 0, 0, 0};
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        for (int j = 0; j < 4; ++j) {
+            double x = b ? a[i + j] * b[i + j] : a[i + j];
+            if (mode == 1) {
+                double y = x - c[j];
+                double t = s[j] + y;
+                c[j] = (t - s[j]) - y;
+                s[j] = t;
+            } else {
+                s[j] += x;
+            }
+        }
+    }
+    double r = rox_lanes_f64(s);
+    for (; i < n; ++i) r += b ? a[i] * b[i] : a[i];
+    return r;
+}
+#if ROX_X86
+__attribute__((target("avx2")))
+double rox_sum_f64_avx2(const double* a, const double* b, size_t n, int mode) {
+    __m256d s = _mm256_setzero_pd(), c = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        if (b) x = _mm256_mul_pd(x, _mm256_loadu_pd(b + i));
+        if (mode == 1) {
+            __m256d y = _mm256_sub_pd(x, c);
+            __m256d t = _mm256_add_pd(s, y);
+            c = _mm256_sub_pd(_mm256_sub_pd(t, s), y);
+            s = t;
+        } else {
+            s = _mm256_add_pd(s, x);
+        }
+    }
+    alignas(32) double l[4];
+    _mm256_store_pd(l, s);
+    double r = rox_lanes_f64(l);
+    for (; i < n; ++i) r += b ? a[i] * b[i] : a[i];
+    return r;
+}
+double rox_sum_f64_sse2(const double* a, const double* b, size_t n, int mode) {
+    __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd(), c0 = _mm_setzero_pd(), c1 = _mm_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128d x0 = _mm_loadu_pd(a + i), x1 = _mm_loadu_pd(a + i + 2);
+        if (b) {
+            x0 = _mm_mul_pd(x0, _mm_loadu_pd(b + i));
+            x1 = _mm_mul_pd(x1, _mm_loadu_pd(b + i + 2));
+        }
+        if (mode == 1) {
+            __m128d y0 = _mm_sub_pd(x0, c0), y1 = _mm_sub_pd(x1, c1);
+            __m128d t0 = _mm_add_pd(s0, y0), t1 = _mm_add_pd(s1, y1);
+            c0 = _mm_sub_pd(_mm_sub_pd(t0, s0), y0);
+            c1 = _mm_sub_pd(_mm_sub_pd(t1, s1), y1);
+            s0 = t0;
+            s1 = t1;
+        } else {
+            s0 = _mm_add_pd(s0, x0);
+            s1 = _mm_add_pd(s1, x1);
+        }
+    }
+    alignas(16) double l[4];
+    _mm_store_pd(l, s0);
+    _mm_store_pd(l + 2, s1);
+    double r = rox_lanes_f64(l);
+    for (; i < n; ++i) r += b ? a[i] * b[i] : a[i];
+    return r;
+}
+#endif
+double rox_sum_f64_block(const double* a, const double* b, size_t n, int mode) {
+#if ROX_X86
+    if (rox_has_avx2()) return rox_sum_f64_avx2(a, b, n, mode);
+    return rox_sum_f64_sse2(a, b, n, mode);
+#else
+    return rox_sum_f64_scalar(a, b, n, mode);
+#endif
+}
+// Pairwise summation over 4-lane blocks: error grows with log(n) instead of n.
+double rox_pairwise_f64(const double* a, const double* b, size_t n) {
+    if (n <= 256) return rox_sum_f64_block(a, b, n, 0);
+    size_t half = (n / 2 + 3) & ~(size_t)3;
+    return rox_pairwise_f64(a, b, half) + rox_pairwise_f64(a + half, b ? b + half : nullptr, n - half);
+}
+double float64_sum(const std::vector<double>& xs) {
+    return rox_pairwise_f64(xs.data(), nullptr, xs.size());
+}
+double float64_sum_kahan(const std::vector<double>& xs) {
+    return rox_sum_f64_block(xs.data(), nullptr, xs.size(), 1);
+}
+rox_result<double> float64_dot(const std::vector<double>& a, const std::vector<double>& b) {
+    if (a.size() != b.size()) return error<double>("Length mismatch");
+    return ok(rox_pairwise_f64(a.data(), b.data(), a.size()));
+}
+
+// count_equal
+template<typename T>
+int64_t count_equal(const std::vector<T>& xs, T value) {
+    int64_t n = 0;
+    for (const auto& x : xs) n += (x == value);
+    return n;
+}
+#if ROX_X86
+__attribute__((target("avx2")))
+int64_t rox_count_eq_i64_avx2(const int64_t* p, size_t n, int64_t value) {
+    __m256i v = _mm256_set1_epi64x(value), acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        acc = _mm256_sub_epi64(acc, _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(p + i)), v));
+    }
+    alignas(32) int64_t lanes[4];
+    _mm256_store_si256((__m256i*)lanes, acc);
+    int64_t r = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < n; ++i) r += (p[i] == value);
+    return r;
+}
+__attribute__((target("sse4.2")))
+int64_t rox_count_eq_i64_sse42(const int64_t* p, size_t n, int64_t value) {
+    __m128i v = _mm_set1_epi64x(value), acc = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        acc = _mm_sub_epi64(acc, _mm_cmpeq_epi64(_mm_loadu_si128((const __m128i*)(p + i)), v));
+    }
+    alignas(16) int64_t lanes[2];
+    _mm_store_si128((__m128i*)lanes, acc);
+    int64_t r = lanes[0] + lanes[1];
+    for (; i < n; ++i) r += (p[i] == value);
+    return r;
+}
+#endif
+template<>
+int64_t count_equal<int64_t>(const std::vector<int64_t>& xs, int64_t value) {
+#if ROX_X86
+    if (rox_has_avx2()) return rox_count_eq_i64_avx2(xs.data(), xs.size(), value);
+    if (rox_has_sse42()) return rox_count_eq_i64_sse42(xs.data(), xs.size(), value);
+#endif
+    int64_t n = 0;
+    for (int64_t x : xs) n += (x == value);
+    return n;
+}
+
+
+// End Runtime
+
+int64_t roxv26_scalar_sum(std::vector<int64_t> roxv26_xs);
+int64_t roxv26_scalar_min(std::vector<int64_t> roxv26_xs);
+int64_t roxv26_scalar_max(std::vector<int64_t> roxv26_xs);
+int64_t roxv26_scalar_count(std::vector<int64_t> roxv26_xs, int64_t roxv26_value);
+bool roxv26_close(double roxv26_a, double roxv26_b);
+
+int64_t roxv26_scalar_sum(std::vector<int64_t> roxv26_xs) {
+  int64_t roxv26_total = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    (roxv26_total = (roxv26_total + roxv26_x));
+  }
+  return roxv26_total;
+}
+int64_t roxv26_scalar_min(std::vector<int64_t> roxv26_xs) {
+  int64_t roxv26_m = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)roxv26_xs.size()); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    rox_result<int64_t> roxv26_r = rox_at_unchecked(roxv26_xs, roxv26_i);
+    if (((roxv26_i == ((int64_t)0)) || (roxv26_r.value < roxv26_m)))     {
+      (roxv26_m = roxv26_r.value);
+    }
+  }
+  return roxv26_m;
+}
+int64_t roxv26_scalar_max(std::vector<int64_t> roxv26_xs) {
+  int64_t roxv26_m = ((int64_t)0);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)roxv26_xs.size()); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    rox_result<int64_t> roxv26_r = rox_at_unchecked(roxv26_xs, roxv26_i);
+    if (((roxv26_i == ((int64_t)0)) || (roxv26_r.value > roxv26_m)))     {
+      (roxv26_m = roxv26_r.value);
+    }
+  }
+  return roxv26_m;
+}
+int64_t roxv26_scalar_count(std::vector<int64_t> roxv26_xs, int64_t roxv26_value) {
+  int64_t roxv26_count = ((int64_t)0);
+  for (auto roxv26_x : roxv26_xs)   {
+    if ((roxv26_x == roxv26_value))     {
+      (roxv26_count = (roxv26_count + ((int64_t)1)));
+    }
+  }
+  return roxv26_count;
+}
+bool roxv26_close(double roxv26_a, double roxv26_b) {
+  return (float64_abs((roxv26_a - roxv26_b)) <= (0.000000001 * float64_max(1.0, float64_abs(roxv26_b))));
+}
+int main() {
+  std::vector<int64_t> roxv26_xs{};
+  std::vector<double> roxv26_fs{};
+  std::vector<double> roxv26_gs{};
+  int64_t roxv26_seed = ((int64_t)12345);
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end0 = ((int64_t)1003); roxv26_i < roxv26__end0; roxv26_i += ((int64_t)1))   {
+    (roxv26_seed = ((roxv26_seed * ((int64_t)1103515245)) + ((int64_t)12345)));
+    int64_t roxv26_v = roxv26_seed;
+    rox_result<int64_t> roxv26_m = rox_mod_unchecked(roxv26_seed, ((int64_t)1000));
+    if (true)     {
+      (roxv26_v = roxv26_m.value);
+    }
+    roxv26_xs.push_back(roxv26_v);
+    roxv26_fs.push_back(1.3);
+    roxv26_gs.push_back(2.5);
+  }
+  roxv26_fs.push_back(1000000.125);
+  roxv26_gs.push_back((-0.5));
+  print((int64_sum(roxv26_xs) == roxv26_scalar_sum(roxv26_xs)), rox_str("\n"));
+  rox_result<int64_t> roxv26_lo = int64_list_min(roxv26_xs);
+  rox_result<int64_t> roxv26_hi = int64_list_max(roxv26_xs);
+  if (isOk(roxv26_lo))   {
+    if (isOk(roxv26_hi))     {
+      print((getValue(roxv26_lo) == roxv26_scalar_min(roxv26_xs)), rox_str(" "), (getValue(roxv26_hi) == roxv26_scalar_max(roxv26_xs)), rox_str("\n"));
+    }
+  }
+  rox_result<int64_t> roxv26_v3 = rox_at(roxv26_xs, ((int64_t)3));
+  if (isOk(roxv26_v3))   {
+    print((count_equal(roxv26_xs, getValue(roxv26_v3)) == roxv26_scalar_count(roxv26_xs, getValue(roxv26_v3))), rox_str("\n"));
+  }
+  double roxv26_fsum = 0.0;
+  double roxv26_fdot = 0.0;
+  for (int64_t roxv26_i = ((int64_t)0), roxv26__end1 = ((int64_t)roxv26_fs.size()); roxv26_i < roxv26__end1; roxv26_i += ((int64_t)1))   {
+    rox_result<double> roxv26_a = rox_at(roxv26_fs, roxv26_i);
+    rox_result<double> roxv26_b = rox_at(roxv26_gs, roxv26_i);
+    if (isOk(roxv26_a))     {
+      if (isOk(roxv26_b))       {
+        (roxv26_fsum = (roxv26_fsum + getValue(roxv26_a)));
+        (roxv26_fdot = (roxv26_fdot + (getValue(roxv26_a) * getValue(roxv26_b))));
+      }
+    }
+  }
+  print(roxv26_close(float64_sum(roxv26_fs), roxv26_fsum), rox_str(" "), roxv26_close(float64_sum_kahan(roxv26_fs), roxv26_fsum), rox_str("\n"));
+  rox_result<double> roxv26_dot = float64_dot(roxv26_fs, roxv26_gs);
+  if (isOk(roxv26_dot))   {
+    print(roxv26_close(getValue(roxv26_dot), roxv26_fdot), rox_str("\n"));
+  }
+  std::vector<int64_t> roxv26_empty{};
+  print(isOk(int64_list_min(roxv26_empty)), rox_str(" "), int64_sum(roxv26_empty), rox_str("\n"));
+  std::vector<double> roxv26_short = std::vector<double>{1.0};
+  print(isOk(float64_dot(roxv26_fs, roxv26_short)), rox_str("\n"));
+  return 0;
+}
@@ -5,6 +5,7 @@
 #include <vector>
 #include <memory>
 #include <variant>
+#include <functional>
 #include "token.h"
 
 namespace rox {
@@ -31,6 +32,20 @@ struct ListType : Type {
     std::unique_ptr<Type> clone() const override { return std::make_unique<ListType>(elementType->clone()); }
 };
 
+// soa_list[T]: a list of records stored as one array per field. Behaves like list[T].
+struct SoaListType : ListType {
+    SoaListType(std::unique_ptr<Type> elementType) : ListType(std::move(elementType)) {}
+    std::string toString() const override { return "soa_list[" + elementType->toString() + "]"; }
+    std::unique_ptr<Type> clone() const override { return std::make_unique<SoaListType>(elementType->clone()); }
+};
+
+struct TaskType : Type {
+    std::unique_ptr<Type> resultType;
+    TaskType(std::unique_ptr<Type> resultType) : resultType(std::move(resultType)) {}
+    std::string toString() const override { return "task[" + resultType->toString() + "]"; }
+    std::unique_ptr<Type> clone() const override { return std::make_unique<TaskType>(resultType->clone()); }
+};
+
 struct DictionaryType : Type {
     std::unique_ptr<Type> keyType;
     std::unique_ptr<Type> valueType;
@@ -82,8 +97,11 @@ struct RecordType : Type {
 
 // --- Expressions ---
 
+struct FunctionStmt;
+
 struct Expr {
     virtual ~Expr() = default;
+    Type* type = nullptr; // set by Sema; interned in its TypeTable
 };
 
 struct LogicalExpr : Expr {
@@ -116,6 +134,7 @@ struct LiteralExpr : Expr {
 
 struct VariableExpr : Expr {
     Token name;
+    FunctionStmt* function = nullptr; // set by Sema when the name is a top-level function
     VariableExpr(Token name) : name(name) {}
 };
 
@@ -177,6 +196,30 @@ struct DefaultExpr : Expr {
     DefaultExpr(std::unique_ptr<Type> type) : type(std::move(type)) {}
 };
 
+// A result known to be ok, e.g. a folded `10 / 2`. Never written by the user.
+struct OkExpr : Expr {
+    std::unique_ptr<Expr> value;
+    OkExpr(std::unique_ptr<Expr> value) : value(std::move(value)) {}
+};
+
+// Line of the first token an expression carries, or 0 (e.g. an empty list literal).
+inline int lineOf(Expr* expr) {
+    if (auto* e = dynamic_cast<LiteralExpr*>(expr)) return e->value.line;
+    if (auto* e = dynamic_cast<VariableExpr*>(expr)) return e->name.line;
+    if (auto* e = dynamic_cast<AssignmentExpr*>(expr)) return e->name.line;
+    if (auto* e = dynamic_cast<BinaryExpr*>(expr)) return e->op.line;
+    if (auto* e = dynamic_cast<LogicalExpr*>(expr)) return e->op.line;
+    if (auto* e = dynamic_cast<UnaryExpr*>(expr)) return e->op.line;
+    if (auto* e = dynamic_cast<CallExpr*>(expr)) return e->paren.line;
+    if (auto* e = dynamic_cast<MethodCallExpr*>(expr)) return e->name.line;
+    if (auto* e = dynamic_cast<RecordInitExpr*>(expr)) return e->typeName.line;
+    if (auto* e = dynamic_cast<FieldAccessExpr*>(expr)) return e->fieldName.line;
+    if (auto* e = dynamic_cast<FieldAssignExpr*>(expr)) return e->fieldName.line;
+    if (auto* e = dynamic_cast<OkExpr*>(expr)) return lineOf(e->value.get());
+    if (auto* e = dynamic_cast<ListLiteralExpr*>(expr)) return e->elements.empty() ? 0 : lineOf(e->elements[0].get());
+    return 0;
+}
+
 // --- Statements ---
 
 struct Stmt {
@@ -230,10 +273,15 @@ struct IfStmt : Stmt {
 
 struct ForStmt : Stmt {
     Token iterator;
+    Token valueIterator; // `for k, v in d`: the value name; empty lexeme otherwise
     std::unique_ptr<Expr> iterable; // e.g. range(0, 5, 1) as a CallExpr
     std::unique_ptr<Stmt> body;
-    ForStmt(Token iterator, std::unique_ptr<Expr> iterable, std::unique_ptr<Stmt> body)
-        : iterator(iterator), iterable(std::move(iterable)), body(std::move(body)) {}
+    bool parallel = false; // `parallel for`
+    struct Reduction { Token name; Token op; }; // `reduce(total: +)`
+    std::vector<Reduction> reductions;
+    ForStmt(Token iterator, Token valueIterator, std::unique_ptr<Expr> iterable, std::unique_ptr<Stmt> body)
+        : iterator(iterator), valueIterator(valueIterator), iterable(std::move(iterable)), body(std::move(body)) {}
+    bool isEntryLoop() const { return !valueIterator.lexeme.empty(); }
 };
 
 struct FunctionStmt : Stmt {
@@ -257,6 +305,73 @@ struct TypeDefStmt : Stmt {
         : name(name), fields(std::move(fields)) {}
 };
 
+// Line a statement starts on, or 0 for blocks and statements without a token.
+inline int lineOf(Stmt* stmt) {
+    if (auto* s = dynamic_cast<ExprStmt*>(stmt)) return lineOf(s->expression.get());
+    if (auto* s = dynamic_cast<IfStmt*>(stmt)) return lineOf(s->condition.get());
+    if (auto* s = dynamic_cast<ForStmt*>(stmt)) return s->iterator.line;
+    if (auto* s = dynamic_cast<ReturnStmt*>(stmt)) return s->keyword.line;
+    if (auto* s = dynamic_cast<BreakStmt*>(stmt)) return s->keyword.line;
+    if (auto* s = dynamic_cast<ContinueStmt*>(stmt)) return s->keyword.line;
+    if (auto* s = dynamic_cast<LetStmt*>(stmt)) return s->name.line;
+    if (auto* s = dynamic_cast<FunctionStmt*>(stmt)) return s->name.line;
+    if (auto* s = dynamic_cast<TypeDefStmt*>(stmt)) return s->name.line;
+    return 0;
+}
+
+// --- Walking ---
+
+// Calls onExpr on expr and every expression nested inside it.
+inline void walkExpr(Expr* expr, const std::function<void(Expr*)>& onExpr) {
+    if (!expr) return;
+    onExpr(expr);
+    if (auto* e = dynamic_cast<BinaryExpr*>(expr)) { walkExpr(e->left.get(), onExpr); walkExpr(e->right.get(), onExpr); }
+    else if (auto* e = dynamic_cast<LogicalExpr*>(expr)) { walkExpr(e->left.get(), onExpr); walkExpr(e->right.get(), onExpr); }
+    else if (auto* e = dynamic_cast<UnaryExpr*>(expr)) walkExpr(e->right.get(), onExpr);
+    else if (auto* e = dynamic_cast<AssignmentExpr*>(expr)) walkExpr(e->value.get(), onExpr);
+    else if (auto* e = dynamic_cast<CallExpr*>(expr)) {
+        walkExpr(e->callee.get(), onExpr);
+        for (const auto& a : e->arguments) walkExpr(a.get(), onExpr);
+    }
+    else if (auto* e = dynamic_cast<MethodCallExpr*>(expr)) {
+        walkExpr(e->object.get(), onExpr);
+        for (const auto& a : e->arguments) walkExpr(a.get(), onExpr);
+    }
+    else if (auto* e = dynamic_cast<ListLiteralExpr*>(expr)) {
+        for (const auto& el : e->elements) walkExpr(el.get(), onExpr);
+    }
+    else if (auto* e = dynamic_cast<RecordInitExpr*>(expr)) {
+        for (const auto& f : e->fields) walkExpr(f.value.get(), onExpr);
+    }
+    else if (auto* e = dynamic_cast<FieldAccessExpr*>(expr)) walkExpr(e->object.get(), onExpr);
+    else if (auto* e = dynamic_cast<FieldAssignExpr*>(expr)) { walkExpr(e->object.get(), onExpr); walkExpr(e->value.get(), onExpr); }
+    else if (auto* e = dynamic_cast<OkExpr*>(expr)) walkExpr(e->value.get(), onExpr);
+}
+
+// Calls onStmt on stmt and every statement nested inside it, and onExpr on their expressions.
+inline void walkStmt(Stmt* stmt, const std::function<void(Stmt*)>& onStmt, const std::function<void(Expr*)>& onExpr) {
+    if (!stmt) return;
+    onStmt(stmt);
+    if (auto* s = dynamic_cast<BlockStmt*>(stmt)) {
+        for (const auto& c : s->statements) walkStmt(c.get(), onStmt, onExpr);
+    } else if (auto* s = dynamic_cast<IfStmt*>(stmt)) {
+        walkExpr(s->condition.get(), onExpr);
+        walkStmt(s->thenBranch.get(), onStmt, onExpr);
+        walkStmt(s->elseBranch.get(), onStmt, onExpr);
+    } else if (auto* s = dynamic_cast<ForStmt*>(stmt)) {
+        walkExpr(s->iterable.get(), onExpr);
+        walkStmt(s->body.get(), onStmt, onExpr);
+    } else if (auto* s = dynamic_cast<FunctionStmt*>(stmt)) {
+        for (const auto& c : s->body) walkStmt(c.get(), onStmt, onExpr);
+    } else if (auto* s = dynamic_cast<ReturnStmt*>(stmt)) {
+        walkExpr(s->value.get(), onExpr);
+    } else if (auto* s = dynamic_cast<LetStmt*>(stmt)) {
+        walkExpr(s->initializer.get(), onExpr);
+    } else if (auto* s = dynamic_cast<ExprStmt*>(stmt)) {
+        walkExpr(s->expression.get(), onExpr);
+    }
+}
+
 } // namespace rox
 
 #endif // ROX_AST_H
@@ -1,6 +1,16 @@
 #include "codegen.h"
 #include "lexer.h"
 #include <iostream>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -10,28 +20,43 @@ namespace rox {
 // is_ok, get_value, and print functions moved to emitPreamble
 
 
-Codegen::Codegen(const std::vector<std::unique_ptr<Stmt>>& statements) : statements(statements) {
+Codegen::Codegen(const std::vector<std::unique_ptr<Stmt>>& statements, unsigned jobs)
+    : statements(statements), jobs(jobs ? jobs : 1) {
     enterScope();
 }
 
+// A worker generates function bodies for `parent`, whose declarations it shares.
+Codegen::Codegen(const Codegen* parent)
+    : statements(parent->statements), isWorker(true), lastVarId(parent->lastVarId), typeRegistry(parent->typeRegistry),
+      smallListReturns(parent->smallListReturns), soaRecords(parent->soaRecords) {}
+
+// Reports the compile error written to errorOut. A worker cannot exit from under its
+// siblings, so it unwinds to generateFunctions(), which reports the first error in source order.
+void Codegen::fail() {
+    if (isWorker || checking) throw Abort{};
+    std::cerr << errorOut.str();
+    exit(1);
+}
+
 void Codegen::enterScope() {
     scopes.push_back({});
 }
 
 void Codegen::exitScope() {
     if (scopes.empty()) {
-        std::cerr << "Internal Compiler Error: Unbalanced scope exit." << std::endl;
-        exit(1);
+        errorOut << "Internal Compiler Error: Unbalanced scope exit." << std::endl;
+        fail();
     }
     scopes.pop_back();
 }
 
 void Codegen::declareVar(const std::string& name, Type* type) {
     if (scopes.empty()) {
-        std::cerr << "Internal Compiler Error: declaration outside scope." << std::endl;
-        exit(1);
+        errorOut << "Internal Compiler Error: declaration outside scope." << std::endl;
+        fail();
     }
-    scopes.back()[name] = {type, false};
+    VarInfo& info = scopes.back()[name] = {type, false};
+    info.id = ++lastVarId;
 }
 
 auto Codegen::resolveVar(const std::string& name) -> VarInfo* {
@@ -55,26 +80,596 @@ void Codegen::invalidateVar(const std::string& name) {
     VarInfo* info = resolveVar(name);
     if (info) {
         info->isProvenOk = false;
+        info->isStaticOk = false;
+        info->isNonZero = false;
+    }
+}
+
+bool Codegen::isLocalVar(const std::string& name) {
+    for (size_t i = scopes.size(); i-- > 1;) {
+        if (scopes[i].count(name)) return true;
+    }
+    return false;
+}
+
+// Collects every name that is assigned, or whose collection is mutated, inside a function body.
+static std::unordered_set<std::string> collectMutatedVars(FunctionStmt* fn) {
+    static const std::unordered_set<std::string> mutatingMethods = {"append", "pop", "set", "remove", "sort"};
+    std::unordered_set<std::string> names;
+    walkStmt(fn, [](Stmt*) {}, [&](Expr* e) {
+        if (auto* a = dynamic_cast<AssignmentExpr*>(e)) names.insert(a->name.lexeme);
+        else if (auto* m = dynamic_cast<MethodCallExpr*>(e)) {
+            if (!mutatingMethods.count(m->name.lexeme)) return;
+            if (auto* v = dynamic_cast<VariableExpr*>(m->object.get())) names.insert(v->name.lexeme);
+        }
+    });
+    return names;
+}
+
+// Calls fn on type and every type nested inside it.
+static void walkType(Type* type, const std::function<void(Type*)>& fn) {
+    if (!type) return;
+    fn(type);
+    if (auto* t = dynamic_cast<ListType*>(type)) walkType(t->elementType.get(), fn);
+    else if (auto* t = dynamic_cast<DictionaryType*>(type)) { walkType(t->keyType.get(), fn); walkType(t->valueType.get(), fn); }
+    else if (auto* t = dynamic_cast<TaskType*>(type)) walkType(t->resultType.get(), fn);
+    else if (auto* t = dynamic_cast<RoxResultType*>(type)) walkType(t->valueType.get(), fn);
+    else if (auto* t = dynamic_cast<FunctionType*>(type)) {
+        for (const auto& p : t->paramTypes) walkType(p.get(), fn);
+        walkType(t->returnType.get(), fn);
+    }
+}
+
+// Names of the record types stored in a soa_list anywhere in the program. A soa_list of
+// anything else sets `error`.
+static std::unordered_set<std::string> collectSoaRecords(const std::vector<std::unique_ptr<Stmt>>& statements, std::string& error) {
+    std::unordered_set<std::string> records;
+    auto visit = [&](Type* type) {
+        walkType(type, [&](Type* t) {
+            auto* soa = dynamic_cast<SoaListType*>(t);
+            if (!soa) return;
+            auto* record = dynamic_cast<RecordType*>(soa->elementType.get());
+            if (!record) {
+                if (error.empty()) {
+                    error = "Compile Error: soa_list elements must be a record type, not " + soa->elementType->toString() + ".\n";
+                }
+                return;
+            }
+            records.insert(record->name);
+        });
+    };
+    for (const auto& stmt : statements) {
+        walkStmt(stmt.get(), [&](Stmt* s) {
+            if (auto* let = dynamic_cast<LetStmt*>(s)) visit(let->type.get());
+            else if (auto* fn = dynamic_cast<FunctionStmt*>(s)) {
+                for (const auto& p : fn->params) visit(p.type.get());
+                visit(fn->returnType.get());
+            } else if (auto* td = dynamic_cast<TypeDefStmt*>(s)) {
+                for (const auto& f : td->fields) visit(f.type.get());
+            }
+        }, [&](Expr* e) {
+            if (auto* d = dynamic_cast<DefaultExpr*>(e)) visit(d->type.get());
+        });
+    }
+    return records;
+}
+
+// --- Escape analysis ---
+// Finds local collections that never leave their declaring block: they are only used
+// as the receiver of a method call or as the collection of a `for` loop. Returned,
+// passed, copied or reassigned collections are excluded, as are dictionaries with
+// remove() (the arena never reuses freed nodes).
+static std::unordered_set<LetStmt*> collectNonEscaping(FunctionStmt* fn, const std::function<bool(LetStmt*)>& candidate) {
+    std::unordered_set<LetStmt*> lets;
+    std::unordered_map<std::string, int> declared;
+    std::unordered_set<std::string> disqualified;
+    std::unordered_set<Expr*> receivers; // variable uses that keep the collection in place
+    std::unordered_set<Stmt*> blockChildren; // statements that get a block of their own
+
+    for (const auto& p : fn->params) declared[p.name.lexeme]++;
+    for (const auto& s : fn->body) blockChildren.insert(s.get());
+    walkStmt(fn, [&](Stmt* s) {
+        if (auto* b = dynamic_cast<BlockStmt*>(s)) {
+            for (const auto& c : b->statements) blockChildren.insert(c.get());
+        } else if (auto* let = dynamic_cast<LetStmt*>(s)) {
+            declared[let->name.lexeme]++;
+            if (candidate(let)) lets.insert(let);
+        } else if (auto* f = dynamic_cast<ForStmt*>(s)) {
+            declared[f->iterator.lexeme]++;
+            if (f->isEntryLoop()) declared[f->valueIterator.lexeme]++;
+            if (dynamic_cast<VariableExpr*>(f->iterable.get())) receivers.insert(f->iterable.get());
+        }
+    }, [&](Expr* e) {
+        if (auto* m = dynamic_cast<MethodCallExpr*>(e)) {
+            if (auto* v = dynamic_cast<VariableExpr*>(m->object.get())) {
+                receivers.insert(v);
+                if (m->name.lexeme == "remove") disqualified.insert(v->name.lexeme);
+            }
+        } else if (auto* a = dynamic_cast<AssignmentExpr*>(e)) {
+            disqualified.insert(a->name.lexeme);
+        }
+    });
+
+    walkStmt(fn, [](Stmt*) {}, [&](Expr* e) {
+        auto* v = dynamic_cast<VariableExpr*>(e);
+        if (v && !receivers.count(v)) disqualified.insert(v->name.lexeme);
+    });
+    for (auto it = lets.begin(); it != lets.end();) {
+        const std::string& name = (*it)->name.lexeme;
+        if (declared[name] > 1 || disqualified.count(name) || !blockChildren.count(*it)) it = lets.erase(it);
+        else ++it;
+    }
+    return lets;
+}
+
+// Freshly built non-escaping lists and dictionaries are allocated from a block-scoped
+// arena (RoxArena) instead of the heap. Directly recursive functions are skipped: each
+// activation would carry its own inline arena buffer.
+static std::unordered_set<LetStmt*> collectArenaLets(FunctionStmt* fn) {
+    bool recursive = false;
+    walkStmt(fn, [](Stmt*) {}, [&](Expr* e) {
+        auto* c = dynamic_cast<CallExpr*>(e);
+        auto* callee = c ? dynamic_cast<VariableExpr*>(c->callee.get()) : nullptr;
+        if (callee && callee->name.lexeme == fn->name.lexeme) recursive = true;
+    });
+    if (recursive) return {};
+    return collectNonEscaping(fn, [](LetStmt* let) {
+        bool collection = (dynamic_cast<ListType*>(let->type.get()) && !dynamic_cast<SoaListType*>(let->type.get())) ||
+                          dynamic_cast<DictionaryType*>(let->type.get());
+        Expr* init = let->initializer.get();
+        bool freshInit = !init || (dynamic_cast<ListLiteralExpr*>(init) && dynamic_cast<ListType*>(let->type.get())) ||
+                         (dynamic_cast<DefaultExpr*>(init) && dynamic_cast<DefaultExpr*>(init)->type->toString() == let->type->toString());
+        return collection && freshInit;
+    });
+}
+
+// --- Small lists ---
+// A function whose every return is a list literal of at most kSmallList elements (pairs
+// and triples returned as lists) returns a RoxSmallList with that many inline slots, so
+// building its result never touches the heap. A caller keeps the small list in a local
+// that never escapes; anywhere else the result becomes a std::vector at the call.
+static constexpr size_t kSmallList = 8;
+
+// Inline capacity for fn's result, or 0 when it does not return small lists.
+static size_t smallListCapacity(FunctionStmt* fn) {
+    auto* lt = dynamic_cast<ListType*>(fn->returnType.get());
+    if (!lt || dynamic_cast<SoaListType*>(lt)) return 0;
+    auto* elem = dynamic_cast<PrimitiveType*>(lt->elementType.get());
+    if (elem && elem->token.type == TokenType::TYPE_BOOL) return 0; // the spill vector would pack bits
+    size_t capacity = 1;
+    bool small = true;
+    walkStmt(fn, [&](Stmt* s) {
+        auto* ret = dynamic_cast<ReturnStmt*>(s);
+        if (!ret) return;
+        auto* lit = dynamic_cast<ListLiteralExpr*>(ret->value.get());
+        if (!lit || lit->elements.size() > kSmallList) small = false;
+        else capacity = std::max(capacity, lit->elements.size());
+    }, [](Expr*) {});
+    return small ? capacity : 0;
+}
+
+// Locals initialized by a call to a small-list function that never leave their block.
+static std::unordered_set<LetStmt*> collectSmallLets(FunctionStmt* fn, const std::unordered_map<std::string, size_t>& smallReturns) {
+    return collectNonEscaping(fn, [&](LetStmt* let) {
+        auto* call = dynamic_cast<CallExpr*>(let->initializer.get());
+        auto* callee = call ? dynamic_cast<VariableExpr*>(call->callee.get()) : nullptr;
+        return callee && smallReturns.count(callee->name.lexeme) && dynamic_cast<ListType*>(let->type.get()) &&
+               !dynamic_cast<SoaListType*>(let->type.get());
+    });
+}
+
+// --- Range analysis ---
+// Proves `for i in range(lo, xs.size(), step)` keeps i inside [0, xs.size()) so that
+// xs.at(i) can skip its bounds check. Collections are identified by the id of their
+// declaration, so neither shadowing nor sibling loop iterators alias a proof.
+
+// Returns the id of the collection whose size `expr` provably equals, or 0.
+size_t Codegen::provenSizeOf(Expr* expr) {
+    if (auto* m = dynamic_cast<MethodCallExpr*>(expr)) {
+        auto* var = dynamic_cast<VariableExpr*>(m->object.get());
+        if (!var || m->name.lexeme != "size" || !m->arguments.empty()) return 0;
+        if (!isLocalVar(var->name.lexeme) || mutatedVars.count(var->name.lexeme)) return 0;
+        VarInfo* info = resolveVar(var->name.lexeme);
+        if (!info || !info->type) return 0;
+        if (dynamic_cast<ListType*>(info->type)) return info->id;
+        if (auto* pt = dynamic_cast<PrimitiveType*>(info->type)) {
+            if (pt->token.type == TokenType::TYPE_STRING || pt->token.type == TokenType::TYPE_FILE_VIEW) return info->id;
+        }
+        return 0;
+    }
+    if (auto* var = dynamic_cast<VariableExpr*>(expr)) {
+        if (mutatedVars.count(var->name.lexeme)) return 0;
+        VarInfo* info = resolveVar(var->name.lexeme);
+        return info ? info->sizeOf : 0;
+    }
+    return 0;
+}
+
+bool Codegen::isNonNegative(Expr* expr) {
+    if (auto* lit = dynamic_cast<LiteralExpr*>(expr)) {
+        return lit->value.type == TokenType::NUMBER_INT;
+    }
+    if (auto* var = dynamic_cast<VariableExpr*>(expr)) {
+        if (mutatedVars.count(var->name.lexeme)) return false;
+        VarInfo* info = resolveVar(var->name.lexeme);
+        return info && (info->indexOf || info->sizeOf);
     }
+    if (auto* bin = dynamic_cast<BinaryExpr*>(expr)) {
+        if (bin->op.type == TokenType::PLUS || bin->op.type == TokenType::STAR) {
+            return isNonNegative(bin->left.get()) && isNonNegative(bin->right.get());
+        }
+    }
+    return false;
+}
+
+// xs.at(i) where i is a range iterator proven to index this very declaration of xs.
+bool Codegen::isProvenAccess(MethodCallExpr* expr) {
+    if (expr->name.lexeme != "at" || expr->arguments.size() != 1) return false;
+    auto* coll = dynamic_cast<VariableExpr*>(expr->object.get());
+    auto* idx = dynamic_cast<VariableExpr*>(expr->arguments[0].get());
+    if (!coll || !idx) return false;
+    VarInfo* idxInfo = resolveVar(idx->name.lexeme);
+    VarInfo* collInfo = resolveVar(coll->name.lexeme);
+    return idxInfo && collInfo && idxInfo->indexOf && idxInfo->indexOf == collInfo->id;
+}
+
+// --- Divisor analysis ---
+// `a / b` and `a % b` skip the zero check when b is a nonzero literal, or a local that
+// is never assigned in the function and is initialized from a nonzero value, is a
+// range() iterator that starts away from 0 and moves away from it, or is guarded by
+// a test such as `not (b == 0)`, `b > 0` or an early exit on `b == 0`.
+
+bool Codegen::isNonZero(Expr* expr) {
+    if (auto* unary = dynamic_cast<UnaryExpr*>(expr)) {
+        return unary->op.type == TokenType::MINUS && isNonZero(unary->right.get());
+    }
+    if (auto* lit = dynamic_cast<LiteralExpr*>(expr)) {
+        if (lit->value.type != TokenType::NUMBER_INT && lit->value.type != TokenType::NUMBER_FLOAT) return false;
+        return lit->value.lexeme.find_first_not_of("0.") != std::string::npos;
+    }
+    if (auto* var = dynamic_cast<VariableExpr*>(expr)) {
+        if (mutatedVars.count(var->name.lexeme) || !isLocalVar(var->name.lexeme)) return false;
+        VarInfo* info = resolveVar(var->name.lexeme);
+        return info && info->isNonZero;
+    }
+    return false;
+}
+
+bool Codegen::isProvenDivision(Expr* expr) {
+    auto* bin = dynamic_cast<BinaryExpr*>(expr);
+    return bin && (bin->op.type == TokenType::SLASH || bin->op.type == TokenType::PERCENT) && isNonZero(bin->right.get());
+}
+
+// Records names as nonzero in the innermost scope only, so a proof made inside a branch
+// or loop body never outlives it.
+void Codegen::proveNonZero(const std::vector<std::string>& names) {
+    for (const auto& name : names) {
+        if (mutatedVars.count(name) || !isLocalVar(name)) continue;
+        VarInfo* outer = resolveVar(name);
+        if (!outer) continue;
+        VarInfo refined = *outer;
+        refined.isNonZero = true;
+        scopes.back()[name] = refined;
+    }
+}
+
+// Sign of a number literal (or negated literal): -1, 0 or 1; 2 if expr is not one.
+static int literalSign(Expr* expr) {
+    bool negate = false;
+    if (auto* unary = dynamic_cast<UnaryExpr*>(expr)) {
+        if (unary->op.type != TokenType::MINUS) return 2;
+        negate = true;
+        expr = unary->right.get();
+    }
+    auto* lit = dynamic_cast<LiteralExpr*>(expr);
+    if (!lit || (lit->value.type != TokenType::NUMBER_INT && lit->value.type != TokenType::NUMBER_FLOAT)) return 2;
+    if (lit->value.lexeme.find_first_not_of("0.") == std::string::npos) return 0;
+    return negate ? -1 : 1;
+}
+
+// Variables a condition proves nonzero when it holds (whenTrue) and when it fails (whenFalse).
+static void nonZeroFacts(Expr* cond, std::vector<std::string>& whenTrue, std::vector<std::string>& whenFalse) {
+    if (auto* logical = dynamic_cast<LogicalExpr*>(cond)) {
+        std::vector<std::string> discard;
+        if (logical->op.type == TokenType::AND) {
+            nonZeroFacts(logical->left.get(), whenTrue, discard);
+            nonZeroFacts(logical->right.get(), whenTrue, discard);
+        } else {
+            nonZeroFacts(logical->left.get(), discard, whenFalse);
+            nonZeroFacts(logical->right.get(), discard, whenFalse);
+        }
+        return;
+    }
+    if (auto* unary = dynamic_cast<UnaryExpr*>(cond)) {
+        if (unary->op.type == TokenType::NOT) nonZeroFacts(unary->right.get(), whenFalse, whenTrue);
+        return;
+    }
+    auto* bin = dynamic_cast<BinaryExpr*>(cond);
+    if (!bin) return;
+    TokenType op = bin->op.type;
+    auto* var = dynamic_cast<VariableExpr*>(bin->left.get());
+    int sign = literalSign(bin->right.get());
+    if (!var) {
+        // Put the variable on the left: `0 < d` is `d > 0`.
+        var = dynamic_cast<VariableExpr*>(bin->right.get());
+        sign = literalSign(bin->left.get());
+        if (op == TokenType::LESS) op = TokenType::GREATER;
+        else if (op == TokenType::GREATER) op = TokenType::LESS;
+        else if (op == TokenType::LESS_EQUAL) op = TokenType::GREATER_EQUAL;
+        else if (op == TokenType::GREATER_EQUAL) op = TokenType::LESS_EQUAL;
+    }
+    if (!var || sign == 2) return;
+    const std::string& name = var->name.lexeme;
+    if (op == TokenType::EQUAL_EQUAL) {
+        if (sign == 0) whenFalse.push_back(name);
+        else whenTrue.push_back(name);
+    } else if ((op == TokenType::GREATER && sign >= 0) || (op == TokenType::GREATER_EQUAL && sign > 0) ||
+               (op == TokenType::LESS && sign <= 0) || (op == TokenType::LESS_EQUAL && sign < 0)) {
+        whenTrue.push_back(name);
+    } else if ((op == TokenType::LESS_EQUAL && sign >= 0) || (op == TokenType::LESS && sign > 0) ||
+               (op == TokenType::GREATER_EQUAL && sign <= 0) || (op == TokenType::GREATER && sign < 0)) {
+        whenFalse.push_back(name);
+    }
+}
+
+// Function-typed parameters make a function a template (see genSignature).
+static bool takesFunctions(FunctionStmt* fn) {
+    for (const auto& p : fn->params) {
+        if (dynamic_cast<FunctionType*>(p.type.get())) return true;
+    }
+    return false;
 }
 
 std::string Codegen::generate() {
+    genDeclarations();
+
+    // Second pass: globals in order, function bodies on the workers
+    std::string program = out.str();
+    out.str("");
+    for (const auto& chunk : generateFunctions()) program += chunk.code;
+
+    // The runtime goes in front, cut down to what the program turned out to use.
     emitPreamble();
+    out << program;
+    return out.str();
+}
 
+std::vector<Diagnostic> Codegen::check() {
+    checking = true;
+    try {
+        genDeclarations();
+        generateFunctions();
+    } catch (const Abort&) {
+        std::string message = errorOut.str();
+        while (!message.empty() && message.back() == '\n') message.pop_back();
+        return {{line, message}};
+    }
+    return {};
+}
+
+// Same program as generate(), split for separate compilation (see SplitProgram). Functions
+// are dealt to the units in source order, in runs of roughly equal size.
+Codegen::SplitProgram Codegen::generateSplit(size_t count, const std::string& headerName) {
+    inlineDefinitions = true;
+    genDeclarations();
+    std::string declarations = out.str();
+    out.str("");
+    std::vector<Chunk> chunks = generateFunctions();
+
+    // Globals and function templates (callback users, instantiated by their callers) go
+    // in the header; every other function in a unit.
+    std::string shared;
+    std::vector<std::string> functions;
+    size_t total = 0;
+    for (auto& chunk : chunks) {
+        if (!chunk.fn || takesFunctions(chunk.fn)) {
+            shared += chunk.code;
+        } else {
+            total += chunk.code.size();
+            functions.push_back(std::move(chunk.code));
+        }
+    }
+    emitPreamble();
+    SplitProgram program;
+    program.header = "#pragma once\n" + out.str() + declarations + shared;
+
+    count = std::max<size_t>(1, std::min(count, functions.size()));
+    size_t done = 0;
+    for (size_t i = 0; i < functions.size(); ++i) {
+        // Start a new unit once this one holds its share of the code
+        if (program.units.empty() || (program.units.size() < count && done * count >= total * program.units.size())) {
+            program.units.push_back("#include \"" + headerName + "\"\n\n");
+        }
+        program.units.back() += functions[i];
+        done += functions[i].size();
+    }
+    return program;
+}
+
+// Functions that a statement refers to by name, as resolved by Sema.
+static void collectReferences(Stmt* stmt, std::unordered_set<FunctionStmt*>& functions) {
+    walkStmt(stmt, [](Stmt*) {}, [&](Expr* e) {
+        auto* v = dynamic_cast<VariableExpr*>(e);
+        if (v && v->function) functions.insert(v->function);
+    });
+}
+
+// See FunctionUnit. Every unit defines the globals (inline, as in the split header); a
+// function template is defined in each unit that instantiates it and brings along the
+// prototypes of the functions it calls in turn.
+auto Codegen::generateFunctionUnits(const std::string& runtimeName) -> std::vector<FunctionUnit> {
+    inlineDefinitions = true;
+    genDeclarations();
+    out.str("");
+    std::vector<Chunk> chunks = generateFunctions();
+
+    std::unordered_map<FunctionStmt*, size_t> position;
+    std::string globals;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        if (chunks[i].fn) position[chunks[i].fn] = i;
+        else globals += chunks[i].code;
+    }
+    std::unordered_set<FunctionStmt*> globalRefs;
+    for (const auto& stmt : statements) {
+        if (!dynamic_cast<FunctionStmt*>(stmt.get()) && !dynamic_cast<TypeDefStmt*>(stmt.get())) {
+            collectReferences(stmt.get(), globalRefs);
+        }
+    }
+
+    std::vector<FunctionUnit> units;
+    for (const auto& chunk : chunks) {
+        if (!chunk.fn || takesFunctions(chunk.fn)) continue;
+        std::unordered_set<FunctionStmt*> refs = globalRefs;
+        collectReferences(chunk.fn, refs);
+        std::vector<FunctionStmt*> pending(refs.begin(), refs.end());
+        while (!pending.empty()) {
+            FunctionStmt* fn = pending.back();
+            pending.pop_back();
+            if (!takesFunctions(fn)) continue;
+            std::unordered_set<FunctionStmt*> called;
+            collectReferences(fn, called);
+            for (auto* c : called) {
+                if (refs.insert(c).second) pending.push_back(c);
+            }
+        }
+        std::vector<size_t> order;
+        for (auto* fn : refs) order.push_back(position.at(fn));
+        std::sort(order.begin(), order.end());
+
+        std::string declarations = typeDeclarations;
+        std::string templates;
+        for (size_t i : order) {
+            auto proto = prototypes.find(chunks[i].fn);
+            if (proto != prototypes.end()) declarations += proto->second; // all but main
+            if (takesFunctions(chunks[i].fn)) templates += chunks[i].code;
+        }
+        std::string source = "#include \"" + runtimeName + "\"\n\n";
+        source += declarations + "\n" + globals + templates + chunk.code;
+        units.push_back({chunk.fn->name.lexeme, std::move(source)});
+    }
+    return units;
+}
+
+// Records, soa_list companions and a prototype for every function but main.
+void Codegen::genDeclarations() {
     // First pass: collect type definitions and emit structs
     for (const auto& stmt : statements) {
-        if (auto* td = dynamic_cast<TypeDefStmt*>(stmt.get())) {
-            typeRegistry[td->name.lexeme] = td;
-            genTypeDef(td);
+        if (auto* td = dynamic_cast<TypeDefStmt*>(stmt.get())) typeRegistry[td->name.lexeme] = td;
+        if (auto* fn = dynamic_cast<FunctionStmt*>(stmt.get())) {
+            if (size_t capacity = smallListCapacity(fn)) smallListReturns[fn->name.lexeme] = capacity;
         }
     }
+    // A function used as a value (stored, passed to parallel_map, spawned) must keep the
+    // std::vector signature its function type promises.
+    std::unordered_set<Expr*> callees;
+    for (const auto& stmt : statements) {
+        walkStmt(stmt.get(), [](Stmt*) {}, [&](Expr* e) {
+            if (auto* call = dynamic_cast<CallExpr*>(e)) callees.insert(call->callee.get());
+        });
+    }
+    for (const auto& stmt : statements) {
+        walkStmt(stmt.get(), [](Stmt*) {}, [&](Expr* e) {
+            auto* var = dynamic_cast<VariableExpr*>(e);
+            if (var && !callees.count(e)) smallListReturns.erase(var->name.lexeme);
+        });
+    }
+    for (const auto& stmt : statements) {
+        if (auto* td = dynamic_cast<TypeDefStmt*>(stmt.get())) genTypeDef(td);
+    }
+
+    // soa_list companions, once every record they may contain is complete
+    std::string soaError;
+    soaRecords = collectSoaRecords(statements, soaError);
+    if (!soaError.empty()) {
+        errorOut << soaError;
+        fail();
+    }
+    for (const auto& stmt : statements) {
+        auto* td = dynamic_cast<TypeDefStmt*>(stmt.get());
+        if (td && soaRecords.count(td->name.lexeme)) genSoaType(td);
+    }
 
-    // Second pass: emit everything else
+    typeDeclarations = out.str();
+
+    // Forward declarations, so that each function can be generated on its own
+    bool declared = false;
+    for (const auto& stmt : statements) {
+        auto* fn = dynamic_cast<FunctionStmt*>(stmt.get());
+        if (!fn || fn->name.lexeme == "main") continue;
+        std::stringstream declaration;
+        out.swap(declaration);
+        genSignature(fn);
+        out << ";\n";
+        out.swap(declaration);
+        prototypes[fn] = declaration.str();
+        out << prototypes[fn];
+        declared = true;
+    }
+    if (declared) out << "\n";
+}
+
+// Generates every top-level statement after the type definitions and returns their code
+// in source order. Globals are generated here; each function is generated by a worker
+// that sees the globals declared before it. With jobs > 1 the workers run on a pool of
+// threads; the output does not depend on the number of jobs.
+auto Codegen::generateFunctions() -> std::vector<Chunk> {
+    struct Job {
+        size_t chunk;
+        FunctionStmt* fn;
+        std::shared_ptr<const Scope> globals;
+    };
+    std::vector<Chunk> chunks;
+    std::vector<Job> work;
+    std::shared_ptr<const Scope> globals = std::make_shared<const Scope>(scopes.front());
     for (const auto& stmt : statements) {
         if (dynamic_cast<TypeDefStmt*>(stmt.get())) continue; // already emitted
+        if (auto* fn = dynamic_cast<FunctionStmt*>(stmt.get())) {
+            work.push_back({chunks.size(), fn, globals});
+            chunks.push_back({fn, ""});
+            continue;
+        }
         genStmt(stmt.get());
+        chunks.push_back({nullptr, out.str()});
+        out.str("");
+        globals = std::make_shared<const Scope>(scopes.front());
     }
-    return out.str();
+
+    std::vector<Diagnostic> errors(work.size());
+    std::vector<std::unordered_set<std::string>> uses(jobs);
+    std::atomic<size_t> next{0};
+    auto run = [&](unsigned thread) {
+        auto worker = std::make_unique<Codegen>(this);
+        for (size_t k = next++; k < work.size(); k = next++) {
+            worker->scopes.assign(1, *work[k].globals);
+            worker->line = work[k].fn->name.line;
+            try {
+                worker->genFunction(work[k].fn);
+                chunks[work[k].chunk].code = worker->out.str();
+                worker->out.str("");
+            } catch (const Abort&) {
+                errors[k] = {worker->line, worker->errorOut.str()};
+                worker = std::make_unique<Codegen>(this); // drop the abandoned function's state
+            }
+        }
+        uses[thread] = std::move(worker->runtimeUses);
+    };
+    unsigned threads = (unsigned)std::min<size_t>(jobs, work.size());
+    if (threads <= 1) {
+        run(0);
+    } else {
+        std::vector<std::thread> pool;
+        for (unsigned t = 0; t < threads; ++t) pool.emplace_back(run, t);
+        for (auto& t : pool) t.join();
+    }
+
+    for (const auto& error : errors) {
+        if (error.message.empty()) continue;
+        line = error.line;
+        errorOut << error.message;
+        fail();
+    }
+    for (auto& u : uses) runtimeUses.insert(u.begin(), u.end());
+    return chunks;
 }
 
 void Codegen::emitIndent() {
@@ -91,25 +686,157 @@ void Codegen::emitLine(const std::string& s) {
     out << s << "\n";
 }
 
+// --- Runtime fragments ---
+// The preamble is cut into fragments so that a program carries, and clang parses, only
+// the runtime it references. Codegen records fragment names in runtimeUses as it emits
+// calls and types; the core (strings, results, print) is always present.
+
+struct RuntimeFragment {
+    std::vector<std::string> deps;    // fragments it builds on
+    std::vector<std::string> headers; // beyond the core headers
+};
+
+// One-line math builtins, each its own fragment named after the builtin.
+static const std::vector<std::pair<std::string, std::string>>& mathRuntime() {
+    static const std::vector<std::pair<std::string, std::string>> fns = {
+        {"int64_abs", "int64_t int64_abs(int64_t x) { return std::abs(x); }\n"},
+        {"int64_min", "int64_t int64_min(int64_t x, int64_t y) { return std::min(x, y); }\n"},
+        {"int64_max", "int64_t int64_max(int64_t x, int64_t y) { return std::max(x, y); }\n"},
+        {"int64_pow",
+         "rox_result<int64_t> int64_pow(int64_t base, int64_t exp) {\n"
+         "    if (exp < 0) return error<int64_t>(\"Negative exponent\");\n"
+         "    int64_t res = 1;\n"
+         "    for (int i = 0; i < exp; ++i) res *= base;\n"
+         "    return ok(res);\n"
+         "}\n"},
+        {"float64_abs", "double float64_abs(double x) { return std::abs(x); }\n"},
+        {"float64_min", "double float64_min(double x, double y) { return std::min(x, y); }\n"},
+        {"float64_max", "double float64_max(double x, double y) { return std::max(x, y); }\n"},
+        {"float64_pow", "double float64_pow(double x, double y) { return std::pow(x, y); }\n"},
+        {"float64_sqrt",
+         "rox_result<double> float64_sqrt(double x) {\n"
+         "    if (x < 0) return error<double>(\"Negative input for sqrt\");\n"
+         "    return ok(std::sqrt(x));\n"
+         "}\n"},
+        {"float64_sin", "double float64_sin(double x) { return std::sin(x); }\n"},
+        {"float64_cos", "double float64_cos(double x) { return std::cos(x); }\n"},
+        {"float64_tan", "double float64_tan(double x) { return std::tan(x); }\n"},
+        {"float64_log",
+         "rox_result<double> float64_log(double x) {\n"
+         "    if (x <= 0) return error<double>(\"Non-positive input for log\");\n"
+         "    return ok(std::log(x));\n"
+         "}\n"},
+        {"float64_exp", "double float64_exp(double x) { return std::exp(x); }\n"},
+        {"float64_floor", "double float64_floor(double x) { return std::floor(x); }\n"},
+        {"float64_ceil", "double float64_ceil(double x) { return std::ceil(x); }\n"},
+    };
+    return fns;
+}
+
+static const std::unordered_map<std::string, RuntimeFragment>& runtimeFragments() {
+    static const std::unordered_map<std::string, RuntimeFragment> fragments = [] {
+        std::unordered_map<std::string, RuntimeFragment> f = {
+            {"range", {}},
+            {"range_count", {}},
+            {"constants", {}},
+            {"function", {{}, {"utility"}}},
+            {"arena", {{}, {"memory_resource"}}},
+            {"access", {}},
+            {"div", {}},
+            {"dict", {{}, {"unordered_map"}}},
+            {"simd", {}},
+            {"int64_sum", {{"simd"}, {}}},
+            {"int64_minmax", {{"simd"}, {}}},
+            {"float64_sum", {{"simd"}, {}}},
+            {"count_equal", {{"simd"}, {}}},
+            {"sort", {{}, {"algorithm", "type_traits"}}},
+            {"small_list", {{}, {"algorithm", "utility"}}},
+            {"pool", {{}, {"algorithm", "functional", "memory", "thread", "mutex", "condition_variable",
+                           "atomic", "limits", "deque"}}},
+            {"tasks", {{"pool"}, {"optional", "tuple", "type_traits"}}},
+            {"parallel_list", {{"pool"}, {"type_traits", "iterator"}}},
+            {"stdin", {}},
+            {"line", {}},
+            {"stdin_lines", {{"stdin", "line"}, {}}},
+            {"read_file", {{}, {"fcntl.h", "sys/stat.h"}}},
+            {"file_view", {{"line"}, {"memory", "fcntl.h", "sys/mman.h", "sys/stat.h"}}},
+        };
+        for (const auto& fn : mathRuntime()) f[fn.first] = {{}, {"cmath", "algorithm"}};
+        return f;
+    }();
+    return fragments;
+}
+
+// The fragment a builtin name lives in, whether it is called or passed as a value.
+static const char* builtinFragment(const std::string& name) {
+    static const std::unordered_map<std::string, const char*> fragments = [] {
+        std::unordered_map<std::string, const char*> f = {
+            {"range", "range"},
+            {"pi", "constants"}, {"e", "constants"}, {"EOF", "constants"},
+            {"int64_sum", "int64_sum"},
+            {"int64_list_min", "int64_minmax"}, {"int64_list_max", "int64_minmax"},
+            {"float64_sum", "float64_sum"}, {"float64_sum_kahan", "float64_sum"}, {"float64_dot", "float64_sum"},
+            {"count_equal", "count_equal"},
+            {"sort_by", "sort"},
+            {"read_line", "stdin"}, {"read_int64", "stdin"}, {"read_float64", "stdin"},
+            {"stdin_lines", "stdin_lines"},
+            {"read_file", "read_file"},
+            {"map_file", "file_view"},
+            {"parallel_map", "parallel_list"}, {"parallel_filter", "parallel_list"}, {"parallel_reduce", "parallel_list"},
+            {"spawn", "tasks"}, {"join", "tasks"},
+            {"rox_at", "access"}, {"rox_set", "access"},
+            {"rox_get", "dict"}, {"rox_remove", "dict"}, {"rox_has", "dict"}, {"rox_keys", "dict"},
+            {"rox_div", "div"}, {"rox_mod", "div"},
+        };
+        for (const auto& fn : mathRuntime()) f[fn.first] = fn.first.c_str();
+        return f;
+    }();
+    auto it = fragments.find(name);
+    return it == fragments.end() ? nullptr : it->second;
+}
+
 void Codegen::emitPreamble() {
-    out << "#include <iostream>\n";
-    out << "#include <vector>\n";
-    out << "#include <unordered_map>\n";
-    out << "#include <string>\n";
-    out << "#include <cmath>\n";
-    out << "#include <numeric>\n";
-    out << "#include <variant>\n"; // For possible future use or result
-    out << "#include <cstdint>\n";
-    out << "#include <functional>\n"; // For std::function literals
+    std::streampos start = out.tellp();
+    const char* inl = inlineDefinitions ? "inline " : ""; // for definitions outside templates and classes
+    // Fragments this program references, plus everything they build on
+    std::unordered_set<std::string> parts = runtimeUses;
+    std::vector<std::string> pending(parts.begin(), parts.end());
+    while (!pending.empty()) {
+        std::string part = pending.back();
+        pending.pop_back();
+        auto it = runtimeFragments().find(part);
+        if (it == runtimeFragments().end()) continue;
+        for (const auto& dep : it->second.deps) {
+            if (parts.insert(dep).second) pending.push_back(dep);
+        }
+    }
+    auto has = [&](const char* part) { return parts.count(part) > 0; };
+
+    // Core headers cover strings, results and print; fragments add their own.
+    std::unordered_set<std::string> headers = {
+        "iostream", "vector", "string", "cstdint", "cstring", "charconv", "cerrno", "unistd.h", "cstdlib"};
+    for (const auto& part : parts) {
+        auto it = runtimeFragments().find(part);
+        if (it != runtimeFragments().end()) headers.insert(it->second.headers.begin(), it->second.headers.end());
+    }
+    static const char* headerOrder[] = {
+        "iostream", "vector", "unordered_map", "string", "cmath", "cstdint", "functional", "algorithm",
+        "cstring", "type_traits", "charconv", "cerrno", "unistd.h", "memory", "fcntl.h", "sys/mman.h",
+        "sys/stat.h", "thread", "mutex", "condition_variable", "atomic", "limits", "cstdlib", "deque",
+        "optional", "tuple", "iterator", "utility", "memory_resource"};
+    for (const char* h : headerOrder) {
+        if (headers.count(h)) out << "#include <" << h << ">\n";
+    }
 
     out << "\n// ROX Runtime\n";
+    out << "void rox_flush_stdout();\n";
     // out << "using num = int64_t;\n"; // Removed usage of num
 
     out << "using rox_char = char;\n";
     out << "using rox_bool = bool;\n";
 
     out << "struct None { bool operator==(const None&) const { return true; } };\n";
-    out << "const None none = {};\n";
+    out << inl << "const None none = {};\n";
     out << "\n";
     out << "    // Helper for string literals\n";
     out << "class RoxString {\n";
@@ -122,33 +849,45 @@ void Codegen::emitPreamble() {
     out << "    int64_t size() const { return (int64_t)val.size(); }\n";
     out << "    bool operator==(const RoxString& other) const { return val == other.val; }\n";
     out << "    bool operator!=(const RoxString& other) const { return val != other.val; }\n";
+    out << "    bool operator<(const RoxString& other) const { return val < other.val; }\n";
     out << "};\n";
     out << "\n";
-    out << "std::ostream& operator<<(std::ostream& os, const RoxString& s) {\n";
+    out << inl << "std::ostream& operator<<(std::ostream& os, const RoxString& s) {\n";
     out << "    return os << s.val;\n";
     out << "}\n";
     out << "\n";
-    out << "RoxString rox_str(const char* s) {\n";
+    out << inl << "RoxString rox_str(const char* s) {\n";
     out << "    return RoxString(s);\n";
     out << "}\n";
 
-    // RoxRange iterable
-    out << "struct RoxRange {\n";
-    out << "    int64_t start_, end_, step_;\n";
-    out << "    RoxRange(int64_t s, int64_t e, int64_t st) : start_(s), end_(e), step_(st) {\n";
-    out << "        if (st == 0) { std::cerr << \"Runtime Error: range() step cannot be 0.\" << std::endl; exit(1); }\n";
-    out << "    }\n";
-    out << "    struct Iterator {\n";
-    out << "        int64_t current, step, end;\n";
-    out << "        int64_t operator*() const { return current; }\n";
-    out << "        Iterator& operator++() { current += step; return *this; }\n";
-    out << "        bool operator!=(const Iterator& o) const {\n";
-    out << "            return step > 0 ? current < o.current : current > o.current;\n";
-    out << "        }\n";
-    out << "    };\n";
-    out << "    Iterator begin() const { return {start_, step_, end_}; }\n";
-    out << "    Iterator end() const { return {end_, step_, end_}; }\n";
-    out << "};\n\n";
+    if (has("range")) {
+        // RoxRange iterable
+        out << "struct RoxRange {\n";
+        out << "    int64_t start_, end_, step_;\n";
+        out << "    RoxRange(int64_t s, int64_t e, int64_t st) : start_(s), end_(e), step_(st) {\n";
+        out << "        if (st == 0) { rox_flush_stdout(); std::cerr << \"Runtime Error: range() step cannot be 0.\" << std::endl; exit(1); }\n";
+        out << "    }\n";
+        out << "    struct Iterator {\n";
+        out << "        int64_t current, step, end;\n";
+        out << "        int64_t operator*() const { return current; }\n";
+        out << "        Iterator& operator++() { current += step; return *this; }\n";
+        out << "        bool operator!=(const Iterator& o) const {\n";
+        out << "            return step > 0 ? current < o.current : current > o.current;\n";
+        out << "        }\n";
+        out << "    };\n";
+        out << "    Iterator begin() const { return {start_, step_, end_}; }\n";
+        out << "    Iterator end() const { return {end_, step_, end_}; }\n";
+        out << "};\n\n";
+    }
+
+    if (has("range_count")) {
+        // Trip count for range loops whose step is only known at run time
+        out << inl << "int64_t rox_range_count(int64_t start, int64_t end, int64_t step) {\n";
+        out << "    if (step == 0) { rox_flush_stdout(); std::cerr << \"Runtime Error: range() step cannot be 0.\" << std::endl; exit(1); }\n";
+        out << "    if (step > 0) return start < end ? (int64_t)(((uint64_t)end - (uint64_t)start - 1) / (uint64_t)step + 1) : 0;\n";
+        out << "    return start > end ? (int64_t)(((uint64_t)start - (uint64_t)end - 1) / (0 - (uint64_t)step) + 1) : 0;\n";
+        out << "}\n\n";
+    }
 
     // Result type
     out << "template<typename T>\n";
@@ -166,6 +905,7 @@ void Codegen::emitPreamble() {
     out << "template<typename T>\n";
     out << "T getValue(rox_result<T> r) {\n";
     out << "    if (!r.err.val.empty()) {\n";
+    out << "        rox_flush_stdout();\n";
     out << "        std::cerr << \"Runtime Error: \" << r.err.val << std::endl;\n";
     out << "        exit(1);\n";
     out << "    }\n";
@@ -177,168 +917,1429 @@ void Codegen::emitPreamble() {
     out << "    return r.err;\n";
     out << "}\n";
 
-    out << "void print_loop(int64_t n) {\n";
-    out << "    for (int i = 0; i < n; ++i) {\n";
-    out << "        std::cout << \"Hello, World!\" << std::endl;\n";
-    out << "    }\n";
-    out << "}\n";
-
     out << "// Result constructors\n";
     out << "template<typename T>\n";
     out << "rox_result<T> ok(T value) { return {value, RoxString(\"\")}; }\n";
     out << "template<typename T>\n";
     out << "rox_result<T> error(const char* msg) { return {T{}, RoxString(msg)}; }\n";
 
-
     // Built-in constants
-    out << "const double pi = 3.141592653589793;\n";
-    out << "const double e  = 2.718281828459045;\n";
-    out << "const RoxString EOF_CONST = RoxString(\"EOF\");\n";    out << "\n";
+    if (has("constants")) {
+        out << inl << "const double pi = 3.141592653589793;\n";
+        out << inl << "const double e  = 2.718281828459045;\n";
+        out << inl << "const RoxString EOF_CONST = RoxString(\"EOF\");\n";
+    }
+    out << "\n";
     out << "// I/O\n";
-    out << "std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {\n";
+    out << inl << "std::ostream& operator<<(std::ostream& os, const std::vector<char>& s) {\n";
     out << "    for (char c : s) os << c;\n";
     out << "    return os;\n";
     out << "}\n";
     out << "\n";
-    out << "template<typename... Args>\n";
-    out << "None print(const Args&... args) {\n";
-    out << "    ((std::cout << args), ...);\n";
-    out << "    return none;\n";
-    out << "}\n";
-    out << "\n";
-    out << "\n";
-    out << "// List access\n";
-    out << "template<typename T>\n";
-    out << "rox_result<T> rox_at(const std::vector<T>& xs, int64_t i) {\n";
-    out << "    if (i < 0 || i >= (int64_t)xs.size()) return error<T>(\"Index out of bounds\");\n";
-    out << "    return ok(xs[i]);\n";
-    out << "}\n";
-    out << "\n";
-    out << "// List Set\n";
-    out << "template<typename T>\n";
-    out << "void rox_set(std::vector<T>& xs, int64_t i, T val) {\n";
-    out << "    if (i < 0 || i >= (int64_t)xs.size()) {\n";
-    out << "        std::cerr << \"Error: Index out of bounds in list.set\" << std::endl;\n";
-    out << "        exit(1);\n";
-    out << "    }\n";
-    out << "    xs[i] = val;\n";
-    out << "}\n";
-    out << "\n";
-    out << "// String access\n";
-    out << "rox_result<char> rox_at(const RoxString& s, int64_t i) {\n";
-    out << "    if (i < 0 || i >= s.size()) return error<char>(\"Index out of bounds\");\n";
-    out << "    return ok(s.val[i]);\n";
-    out << "}\n";
-    out << "\n";
-
-    out << "\n";
-    out << "// Division\n";
-    out << "template<typename T>\n";
-    out << "rox_result<T> rox_div(T a, T b) {\n";
-    out << "    if (b == 0) return error<T>(\"Division by zero\");\n";
-    out << "    return ok(a / b);\n";
-    out << "}\n";
-    out << "\n";
-    out << "// Modulo\n";
-    out << "template<typename T>\n";
-    out << "rox_result<T> rox_mod(T a, T b) {\n";
-    out << "    if (b == 0) return error<T>(\"Division by zero\");\n";
-    out << "    return ok(a % b);\n";
-    out << "}\n";
-    out << "\n";
-    out << "// Dictionary Hash for RoxString\n";
-    out << "namespace std {\n";
-    out << "    template <> struct hash<RoxString> {\n";
-    out << "        size_t operator()(const RoxString& s) const {\n";
-    out << "            return hash<string>()(s.val);\n";
+    out << "// Buffered stdout: print() formats into a user-space buffer that is written with\n";
+    out << "// write(2) when full, at exit, before reading stdin, and before any runtime error.\n";
+    out << "struct RoxOut {\n";
+    out << "    static constexpr size_t capacity = 1 << 16;\n";
+    out << "    char buf[capacity];\n";
+    out << "    size_t len = 0;\n";
+    out << "    ~RoxOut() { flush(); }\n";
+    out << "    void flush() { writeAll(buf, len); len = 0; }\n";
+    out << "    static void writeAll(const char* p, size_t n) {\n";
+    out << "        while (n > 0) {\n";
+    out << "            ssize_t w = ::write(1, p, n);\n";
+    out << "            if (w < 0 && errno == EINTR) continue;\n";
+    out << "            if (w <= 0) return;\n";
+    out << "            p += w;\n";
+    out << "            n -= (size_t)w;\n";
     out << "        }\n";
-    out << "    };\n";
-    out << "}\n";
-    out << "\n";
-    out << "// Dictionary Access\n";
-    out << "template<typename K, typename V>\n";
-    out << "rox_result<V> rox_get(const std::unordered_map<K, V>& dict, K key) {\n";
-    out << "    auto it = dict.find(key);\n";
-    out << "    if (it == dict.end()) return error<V>(\"Key not found\");\n";
-    out << "    return ok(it->second);\n";
-    out << "}\n";
+    out << "    }\n";
+    out << "    char* reserve(size_t n) { if (len + n > capacity) flush(); return buf + len; }\n";
+    out << "    void put(const char* s, size_t n) {\n";
+    out << "        if (n > capacity / 2) { flush(); writeAll(s, n); return; }\n";
+    out << "        std::memcpy(reserve(n), s, n);\n";
+    out << "        len += n;\n";
+    out << "    }\n";
+    out << "};\n";
+    out << inl << "RoxOut rox_out;\n";
+    out << inl << "void rox_flush_stdout() { rox_out.flush(); }\n";
     out << "\n";
-    out << "// Dictionary Set\n";
-    out << "template<typename K, typename V>\n";
-    out << "void rox_set(std::unordered_map<K, V>& dict, K key, V val) {\n";
-    out << "    dict.insert_or_assign(key, val);\n";
+    out << inl << "void rox_write(int64_t v) {\n";
+    out << "    char* p = rox_out.reserve(24);\n";
+    out << "    rox_out.len = std::to_chars(p, p + 24, v).ptr - rox_out.buf;\n";
     out << "}\n";
-    out << "\n";
-    out << "// Dictionary Remove\n";
-    out << "template<typename K, typename V>\n";
-    out << "void rox_remove(std::unordered_map<K, V>& dict, K key) {\n";
-    out << "    dict.erase(key);\n";
+    out << "// Same text as iostream's default float format (%g, 6 significant digits)\n";
+    out << inl << "void rox_write(double v) {\n";
+    out << "    char* p = rox_out.reserve(32);\n";
+    out << "    rox_out.len = std::to_chars(p, p + 32, v, std::chars_format::general, 6).ptr - rox_out.buf;\n";
     out << "}\n";
+    out << inl << "void rox_write(bool v) { v ? rox_out.put(\"true\", 4) : rox_out.put(\"false\", 5); }\n";
+    out << inl << "void rox_write(char c) { *rox_out.reserve(1) = c; rox_out.len++; }\n";
+    out << inl << "void rox_write(const RoxString& s) { rox_out.put(s.val.data(), s.val.size()); }\n";
+    out << inl << "void rox_write(const std::vector<char>& s) { rox_out.put(s.data(), s.size()); }\n";
     out << "\n";
-    out << "// Dictionary Has\n";
-    out << "template<typename K, typename V>\n";
-    out << "bool rox_has(const std::unordered_map<K, V>& dict, K key) {\n";
-    out << "    return dict.find(key) != dict.end();\n";
+    out << "template<typename... Args>\n";
+    out << "None print(const Args&... args) {\n";
+    out << "    (rox_write(args), ...);\n";
+    out << "    return none;\n";
     out << "}\n";
     out << "\n";
-    out << "// Dictionary Keys\n";
-    out << "template<typename K, typename V>\n";
-    out << "std::vector<K> rox_keys(const std::unordered_map<K, V>& dict) {\n";
-    out << "    std::vector<K> keys;\n";
-    out << "    keys.reserve(dict.size());\n";
-    out << "    for (const auto& kv : dict) {\n";
-    out << "        keys.push_back(kv.first);\n";
-    out << "    }\n";
-    out << "    return keys;\n";
-    out << "}\n";
     out << "\n";
+    if (has("function")) {
+        out << "// Function values: ROX functions are top-level and never capture, so a\n";
+        out << "// function-typed value is a plain pointer.\n";
+        out << "template<typename F>\n";
+        out << "using RoxFn = F*;\n";
+        out << "\n";
+        out << "// A function known at compile time, passed to a callback parameter. Its type names\n";
+        out << "// the function, so each callee is instantiated with a direct, inlinable call.\n";
+        out << "template<auto F>\n";
+        out << "struct RoxKnownFn {\n";
+        out << "    template<typename... A>\n";
+        out << "    decltype(auto) operator()(A&&... a) const { return F(std::forward<A>(a)...); }\n";
+        out << "    constexpr operator decltype(F)() const { return F; }\n";
+        out << "};\n";
+        out << "\n";
+    }
+    if (has("arena")) {
+        out << "// Block-scoped arena for lists and dictionaries that never leave their block.\n";
+        out << "// The first 1 KiB comes from the stack; everything is released when the block exits.\n";
+        out << "struct RoxArena : std::pmr::monotonic_buffer_resource {\n";
+        out << "    alignas(std::max_align_t) std::byte buffer[1024];\n";
+        out << "    RoxArena() : std::pmr::monotonic_buffer_resource(buffer, sizeof buffer) {}\n";
+        out << "};\n";
+        out << "\n";
+    }
 
-    out << "int64_t int64_abs(int64_t x) { return std::abs(x); }\n";
-    out << "int64_t int64_min(int64_t x, int64_t y) { return std::min(x, y); }\n";
-    out << "int64_t int64_max(int64_t x, int64_t y) { return std::max(x, y); }\n";
-    out << "rox_result<int64_t> int64_pow(int64_t base, int64_t exp) {\n";
-    out << "    if (exp < 0) return error<int64_t>(\"Negative exponent\");\n";
-    out << "    int64_t res = 1;\n";
-    out << "    for (int i = 0; i < exp; ++i) res *= base;\n";
-    out << "    return ok(res);\n";
-    out << "}\n";
-    out << "\n";
-    out << "double float64_abs(double x) { return std::abs(x); }\n";
-    out << "double float64_min(double x, double y) { return std::min(x, y); }\n";
-    out << "double float64_max(double x, double y) { return std::max(x, y); }\n";
-    out << "double float64_pow(double x, double y) { return std::pow(x, y); }\n";
-    out << "rox_result<double> float64_sqrt(double x) {\n";
-    out << "    if (x < 0) return error<double>(\"Negative input for sqrt\");\n";
-    out << "    return ok(std::sqrt(x));\n";
-    out << "}\n";
-    out << "double float64_sin(double x) { return std::sin(x); }\n";
-    out << "double float64_cos(double x) { return std::cos(x); }\n";
-    out << "double float64_tan(double x) { return std::tan(x); }\n";
-    out << "rox_result<double> float64_log(double x) {\n";
-    out << "    if (x <= 0) return error<double>(\"Non-positive input for log\");\n";
-    out << "    return ok(std::log(x));\n";
-    out << "}\n";
-    out << "double float64_exp(double x) { return std::exp(x); }\n";
-    out << "double float64_floor(double x) { return std::floor(x); }\n";
-    out << "double float64_ceil(double x) { return std::ceil(x); }\n";
-    out << "\n";
-    out << "\n";
-    out << "\n";
+    if (has("access")) {
+        out << "// List access (any allocator: arena-backed lists are std::pmr::vector)\n";
+        out << "template<typename T, typename A>\n";
+        out << "rox_result<T> rox_at(const std::vector<T, A>& xs, int64_t i) {\n";
+        out << "    if (i < 0 || i >= (int64_t)xs.size()) return error<T>(\"Index out of bounds\");\n";
+        out << "    return ok(xs[i]);\n";
+        out << "}\n";
+        out << "\n";
+        out << "// List Set\n";
+        out << "template<typename T, typename A>\n";
+        out << "void rox_set(std::vector<T, A>& xs, int64_t i, T val) {\n";
+        out << "    if (i < 0 || i >= (int64_t)xs.size()) {\n";
+        out << "        rox_flush_stdout();\n";
+        out << "        std::cerr << \"Error: Index out of bounds in list.set\" << std::endl;\n";
+        out << "        exit(1);\n";
+        out << "    }\n";
+        out << "    xs[i] = val;\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Unchecked list access: only emitted where range analysis proved the index in bounds\n";
+        out << "template<typename T, typename A>\n";
+        out << "rox_result<T> rox_at_unchecked(const std::vector<T, A>& xs, int64_t i) {\n";
+        out << "    return {xs[i], RoxString()};\n";
+        out << "}\n";
+        out << "\n";
+        out << "// soa_list access: SoA containers name their record_type and rebuild records on read\n";
+        out << "template<typename S, typename R = typename S::record_type>\n";
+        out << "rox_result<R> rox_at(const S& xs, int64_t i) {\n";
+        out << "    if (i < 0 || i >= (int64_t)xs.size()) return error<R>(\"Index out of bounds\");\n";
+        out << "    return ok(xs[i]);\n";
+        out << "}\n";
+        out << "\n";
+        out << "template<typename S, typename R = typename S::record_type>\n";
+        out << "rox_result<R> rox_at_unchecked(const S& xs, int64_t i) {\n";
+        out << "    return {xs[i], RoxString()};\n";
+        out << "}\n";
+        out << "\n";
+        out << "template<typename S, typename R = typename S::record_type>\n";
+        out << "void rox_set(S& xs, int64_t i, typename S::record_type val) {\n";
+        out << "    if (i < 0 || i >= (int64_t)xs.size()) {\n";
+        out << "        rox_flush_stdout();\n";
+        out << "        std::cerr << \"Error: Index out of bounds in list.set\" << std::endl;\n";
+        out << "        exit(1);\n";
+        out << "    }\n";
+        out << "    xs.assign(i, val);\n";
+        out << "}\n";
+        out << "\n";
+        out << "// String access\n";
+        out << inl << "rox_result<char> rox_at(const RoxString& s, int64_t i) {\n";
+        out << "    if (i < 0 || i >= s.size()) return error<char>(\"Index out of bounds\");\n";
+        out << "    return ok(s.val[i]);\n";
+        out << "}\n";
+        out << "\n";
+        out << inl << "rox_result<char> rox_at_unchecked(const RoxString& s, int64_t i) {\n";
+        out << "    return {s.val[i], RoxString()};\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("div")) {
+        out << "\n";
+        out << "// Division\n";
+        out << "template<typename T>\n";
+        out << "rox_result<T> rox_div(T a, T b) {\n";
+        out << "    if (b == 0) return error<T>(\"Division by zero\");\n";
+        out << "    return ok(a / b);\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Modulo\n";
+        out << "template<typename T>\n";
+        out << "rox_result<T> rox_mod(T a, T b) {\n";
+        out << "    if (b == 0) return error<T>(\"Division by zero\");\n";
+        out << "    return ok(a % b);\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Division and modulo by a divisor proven nonzero at compile time\n";
+        out << "template<typename T>\n";
+        out << "rox_result<T> rox_div_unchecked(T a, T b) {\n";
+        out << "    return {a / b, RoxString()};\n";
+        out << "}\n";
+        out << "template<typename T>\n";
+        out << "rox_result<T> rox_mod_unchecked(T a, T b) {\n";
+        out << "    return {a % b, RoxString()};\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("dict")) {
+        out << "// Dictionary Hash for RoxString\n";
+        out << "namespace std {\n";
+        out << "    template <> struct hash<RoxString> {\n";
+        out << "        size_t operator()(const RoxString& s) const {\n";
+        out << "            return hash<string>()(s.val);\n";
+        out << "        }\n";
+        out << "    };\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Dictionary Access\n";
+        out << "template<typename K, typename V, typename H, typename E, typename A>\n";
+        out << "rox_result<V> rox_get(const std::unordered_map<K, V, H, E, A>& dict, K key) {\n";
+        out << "    auto it = dict.find(key);\n";
+        out << "    if (it == dict.end()) return error<V>(\"Key not found\");\n";
+        out << "    return ok(it->second);\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Dictionary Set\n";
+        out << "template<typename K, typename V, typename H, typename E, typename A>\n";
+        out << "void rox_set(std::unordered_map<K, V, H, E, A>& dict, K key, V val) {\n";
+        out << "    dict.insert_or_assign(key, val);\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Dictionary Remove\n";
+        out << "template<typename K, typename V, typename H, typename E, typename A>\n";
+        out << "void rox_remove(std::unordered_map<K, V, H, E, A>& dict, K key) {\n";
+        out << "    dict.erase(key);\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Dictionary Has\n";
+        out << "template<typename K, typename V, typename H, typename E, typename A>\n";
+        out << "bool rox_has(const std::unordered_map<K, V, H, E, A>& dict, K key) {\n";
+        out << "    return dict.find(key) != dict.end();\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Dictionary Keys\n";
+        out << "template<typename K, typename V, typename H, typename E, typename A>\n";
+        out << "std::vector<K> rox_keys(const std::unordered_map<K, V, H, E, A>& dict) {\n";
+        out << "    std::vector<K> keys;\n";
+        out << "    keys.reserve(dict.size());\n";
+        out << "    for (const auto& kv : dict) {\n";
+        out << "        keys.push_back(kv.first);\n";
+        out << "    }\n";
+        out << "    return keys;\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    for (const auto& [name, code] : mathRuntime()) {
+        if (parts.count(name)) out << inl << code;
+    }
     out << "\n";
-    out << "// read_line: reads one line from stdin\n";
-    out << "rox_result<RoxString> read_line() {\n";
-    out << "    std::string line;\n";
-    out << "    if (!std::getline(std::cin, line)) return error<RoxString>(\"EOF\");\n";
-    out << "    return ok(RoxString(line));\n";
-    out << "}\n";
+
+    if (has("simd")) {
+        out << "// List reductions: hand-vectorized kernels with runtime AVX2 / SSE dispatch.\n";
+        out << "// Floating-point kernels use the same 4-lane association on every path,\n";
+        out << "// so results do not depend on the CPU the program runs on.\n";
+        out << "#if defined(__x86_64__) || defined(__i386__)\n";
+        out << "#define ROX_X86 1\n";
+        out << "#include <immintrin.h>\n";
+        out << "#endif\n";
+        out << "\n";
+        out << "#if ROX_X86\n";
+        out << inl << "bool rox_has_avx2() {\n";
+        out << "    static const bool has = __builtin_cpu_supports(\"avx2\");\n";
+        out << "    return has;\n";
+        out << "}\n";
+        out << inl << "bool rox_has_sse42() {\n";
+        out << "    static const bool has = __builtin_cpu_supports(\"sse4.2\");\n";
+        out << "    return has;\n";
+        out << "}\n";
+        out << "#endif\n";
+        out << "\n";
+    }
+
+    if (has("int64_sum")) {
+        out << "// int64_sum: wrapping addition, like the scalar loop in practice\n";
+        out << inl << "int64_t rox_sum_i64_scalar(const int64_t* p, size_t n) {\n";
+        out << "    uint64_t s = 0;\n";
+        out << "    for (size_t i = 0; i < n; ++i) s += (uint64_t)p[i];\n";
+        out << "    return (int64_t)s;\n";
+        out << "}\n";
+        out << "#if ROX_X86\n";
+        out << "__attribute__((target(\"avx2\")))\n";
+        out << inl << "int64_t rox_sum_i64_avx2(const int64_t* p, size_t n) {\n";
+        out << "    __m256i acc = _mm256_setzero_si256();\n";
+        out << "    size_t i = 0;\n";
+        out << "    for (; i + 4 <= n; i += 4) acc = _mm256_add_epi64(acc, _mm256_loadu_si256((const __m256i*)(p + i)));\n";
+        out << "    alignas(32) int64_t lanes[4];\n";
+        out << "    _mm256_store_si256((__m256i*)lanes, acc);\n";
+        out << "    uint64_t s = (uint64_t)lanes[0] + (uint64_t)lanes[1] + (uint64_t)lanes[2] + (uint64_t)lanes[3];\n";
+        out << "    return (int64_t)(s + (uint64_t)rox_sum_i64_scalar(p + i, n - i));\n";
+        out << "}\n";
+        out << inl << "int64_t rox_sum_i64_sse2(const int64_t* p, size_t n) {\n";
+        out << "    __m128i acc = _mm_setzero_si128();\n";
+        out << "    size_t i = 0;\n";
+        out << "    for (; i + 2 <= n; i += 2) acc = _mm_add_epi64(acc, _mm_loadu_si128((const __m128i*)(p + i)));\n";
+        out << "    alignas(16) int64_t lanes[2];\n";
+        out << "    _mm_store_si128((__m128i*)lanes, acc);\n";
+        out << "    uint64_t s = (uint64_t)lanes[0] + (uint64_t)lanes[1];\n";
+        out << "    return (int64_t)(s + (uint64_t)rox_sum_i64_scalar(p + i, n - i));\n";
+        out << "}\n";
+        out << "#endif\n";
+        out << inl << "int64_t int64_sum(const std::vector<int64_t>& xs) {\n";
+        out << "#if ROX_X86\n";
+        out << "    if (rox_has_avx2()) return rox_sum_i64_avx2(xs.data(), xs.size());\n";
+        out << "    return rox_sum_i64_sse2(xs.data(), xs.size());\n";
+        out << "#else\n";
+        out << "    return rox_sum_i64_scalar(xs.data(), xs.size());\n";
+        out << "#endif\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("int64_minmax")) {
+        out << "// int64_list_min / int64_list_max\n";
+        out << inl << "int64_t rox_minmax_i64_scalar(const int64_t* p, size_t n, bool wantMax) {\n";
+        out << "    int64_t m = p[0];\n";
+        out << "    for (size_t i = 1; i < n; ++i) m = wantMax ? (p[i] > m ? p[i] : m) : (p[i] < m ? p[i] : m);\n";
+        out << "    return m;\n";
+        out << "}\n";
+        out << "#if ROX_X86\n";
+        out << "__attribute__((target(\"avx2\")))\n";
+        out << inl << "int64_t rox_minmax_i64_avx2(const int64_t* p, size_t n, bool wantMax) {\n";
+        out << "    if (n < 4) return rox_minmax_i64_scalar(p, n, wantMax);\n";
+        out << "    __m256i m = _mm256_loadu_si256((const __m256i*)p);\n";
+        out << "    size_t i = 4;\n";
+        out << "    for (; i + 4 <= n; i += 4) {\n";
+        out << "        __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));\n";
+        out << "        __m256i gt = wantMax ? _mm256_cmpgt_epi64(v, m) : _mm256_cmpgt_epi64(m, v);\n";
+        out << "        m = _mm256_blendv_epi8(m, v, gt);\n";
+        out << "    }\n";
+        out << "    alignas(32) int64_t lanes[4];\n";
+        out << "    _mm256_store_si256((__m256i*)lanes, m);\n";
+        out << "    int64_t r = rox_minmax_i64_scalar(lanes, 4, wantMax);\n";
+        out << "    if (i < n) {\n";
+        out << "        int64_t t = rox_minmax_i64_scalar(p + i, n - i, wantMax);\n";
+        out << "        r = wantMax ? (t > r ? t : r) : (t < r ? t : r);\n";
+        out << "    }\n";
+        out << "    return r;\n";
+        out << "}\n";
+        out << "__attribute__((target(\"sse4.2\")))\n";
+        out << inl << "int64_t rox_minmax_i64_sse42(const int64_t* p, size_t n, bool wantMax) {\n";
+        out << "    if (n < 2) return rox_minmax_i64_scalar(p, n, wantMax);\n";
+        out << "    __m128i m = _mm_loadu_si128((const __m128i*)p);\n";
+        out << "    size_t i = 2;\n";
+        out << "    for (; i + 2 <= n; i += 2) {\n";
+        out << "        __m128i v = _mm_loadu_si128((const __m128i*)(p + i));\n";
+        out << "        __m128i gt = wantMax ? _mm_cmpgt_epi64(v, m) : _mm_cmpgt_epi64(m, v);\n";
+        out << "        m = _mm_blendv_epi8(m, v, gt);\n";
+        out << "    }\n";
+        out << "    alignas(16) int64_t lanes[2];\n";
+        out << "    _mm_store_si128((__m128i*)lanes, m);\n";
+        out << "    int64_t r = rox_minmax_i64_scalar(lanes, 2, wantMax);\n";
+        out << "    if (i < n) {\n";
+        out << "        int64_t t = rox_minmax_i64_scalar(p + i, n - i, wantMax);\n";
+        out << "        r = wantMax ? (t > r ? t : r) : (t < r ? t : r);\n";
+        out << "    }\n";
+        out << "    return r;\n";
+        out << "}\n";
+        out << "#endif\n";
+        out << inl << "int64_t rox_minmax_i64(const std::vector<int64_t>& xs, bool wantMax) {\n";
+        out << "#if ROX_X86\n";
+        out << "    if (rox_has_avx2()) return rox_minmax_i64_avx2(xs.data(), xs.size(), wantMax);\n";
+        out << "    if (rox_has_sse42()) return rox_minmax_i64_sse42(xs.data(), xs.size(), wantMax);\n";
+        out << "#endif\n";
+        out << "    return rox_minmax_i64_scalar(xs.data(), xs.size(), wantMax);\n";
+        out << "}\n";
+        out << inl << "rox_result<int64_t> int64_list_min(const std::vector<int64_t>& xs) {\n";
+        out << "    if (xs.empty()) return error<int64_t>(\"Empty list\");\n";
+        out << "    return ok(rox_minmax_i64(xs, false));\n";
+        out << "}\n";
+        out << inl << "rox_result<int64_t> int64_list_max(const std::vector<int64_t>& xs) {\n";
+        out << "    if (xs.empty()) return error<int64_t>(\"Empty list\");\n";
+        out << "    return ok(rox_minmax_i64(xs, true));\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("float64_sum")) {
+        out << "// float64 kernels: 4 lanes, lane j takes elements i with i % 4 == j,\n";
+        out << "// combined as (l0 + l1) + (l2 + l3), then the tail is added in order.\n";
+        out << inl << "double rox_lanes_f64(const double* l) { return (l[0] + l[1]) + (l[2] + l[3]); }\n";
+        out << "\n";
+        out << "// mode 0: plain lanes, mode 1: Kahan-compensated lanes; b == nullptr sums a, otherwise sums a[i] * b[i]\n";
+        out << inl << "double rox_sum_f64_scalar(const double* a, const double* b, size_t n, int mode) {\n";
+        out << "    double s[4] = {0, 0, 0, 0}, c[4] = {0, 0, 0, 0};\n";
+        out << "    size_t i = 0;\n";
+        out << "    for (; i + 4 <= n; i += 4) {\n";
+        out << "        for (int j = 0; j < 4; ++j) {\n";
+        out << "            double x = b ? a[i + j] * b[i + j] : a[i + j];\n";
+        out << "            if (mode == 1) {\n";
+        out << "                double y = x - c[j];\n";
+        out << "                double t = s[j] + y;\n";
+        out << "                c[j] = (t - s[j]) - y;\n";
+        out << "                s[j] = t;\n";
+        out << "            } else {\n";
+        out << "                s[j] += x;\n";
+        out << "            }\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "    double r = rox_lanes_f64(s);\n";
+        out << "    for (; i < n; ++i) r += b ? a[i] * b[i] : a[i];\n";
+        out << "    return r;\n";
+        out << "}\n";
+        out << "#if ROX_X86\n";
+        out << "__attribute__((target(\"avx2\")))\n";
+        out << inl << "double rox_sum_f64_avx2(const double* a, const double* b, size_t n, int mode) {\n";
+        out << "    __m256d s = _mm256_setzero_pd(), c = _mm256_setzero_pd();\n";
+        out << "    size_t i = 0;\n";
+        out << "    for (; i + 4 <= n; i += 4) {\n";
+        out << "        __m256d x = _mm256_loadu_pd(a + i);\n";
+        out << "        if (b) x = _mm256_mul_pd(x, _mm256_loadu_pd(b + i));\n";
+        out << "        if (mode == 1) {\n";
+        out << "            __m256d y = _mm256_sub_pd(x, c);\n";
+        out << "            __m256d t = _mm256_add_pd(s, y);\n";
+        out << "            c = _mm256_sub_pd(_mm256_sub_pd(t, s), y);\n";
+        out << "            s = t;\n";
+        out << "        } else {\n";
+        out << "            s = _mm256_add_pd(s, x);\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "    alignas(32) double l[4];\n";
+        out << "    _mm256_store_pd(l, s);\n";
+        out << "    double r = rox_lanes_f64(l);\n";
+        out << "    for (; i < n; ++i) r += b ? a[i] * b[i] : a[i];\n";
+        out << "    return r;\n";
+        out << "}\n";
+        out << inl << "double rox_sum_f64_sse2(const double* a, const double* b, size_t n, int mode) {\n";
+        out << "    __m128d s0 = _mm_setzero_pd(), s1 = _mm_setzero_pd(), c0 = _mm_setzero_pd(), c1 = _mm_setzero_pd();\n";
+        out << "    size_t i = 0;\n";
+        out << "    for (; i + 4 <= n; i += 4) {\n";
+        out << "        __m128d x0 = _mm_loadu_pd(a + i), x1 = _mm_loadu_pd(a + i + 2);\n";
+        out << "        if (b) {\n";
+        out << "            x0 = _mm_mul_pd(x0, _mm_loadu_pd(b + i));\n";
+        out << "            x1 = _mm_mul_pd(x1, _mm_loadu_pd(b + i + 2));\n";
+        out << "        }\n";
+        out << "        if (mode == 1) {\n";
+        out << "            __m128d y0 = _mm_sub_pd(x0, c0), y1 = _mm_sub_pd(x1, c1);\n";
+        out << "            __m128d t0 = _mm_add_pd(s0, y0), t1 = _mm_add_pd(s1, y1);\n";
+        out << "            c0 = _mm_sub_pd(_mm_sub_pd(t0, s0), y0);\n";
+        out << "            c1 = _mm_sub_pd(_mm_sub_pd(t1, s1), y1);\n";
+        out << "            s0 = t0;\n";
+        out << "            s1 = t1;\n";
+        out << "        } else {\n";
+        out << "            s0 = _mm_add_pd(s0, x0);\n";
+        out << "            s1 = _mm_add_pd(s1, x1);\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "    alignas(16) double l[4];\n";
+        out << "    _mm_store_pd(l, s0);\n";
+        out << "    _mm_store_pd(l + 2, s1);\n";
+        out << "    double r = rox_lanes_f64(l);\n";
+        out << "    for (; i < n; ++i) r += b ? a[i] * b[i] : a[i];\n";
+        out << "    return r;\n";
+        out << "}\n";
+        out << "#endif\n";
+        out << inl << "double rox_sum_f64_block(const double* a, const double* b, size_t n, int mode) {\n";
+        out << "#if ROX_X86\n";
+        out << "    if (rox_has_avx2()) return rox_sum_f64_avx2(a, b, n, mode);\n";
+        out << "    return rox_sum_f64_sse2(a, b, n, mode);\n";
+        out << "#else\n";
+        out << "    return rox_sum_f64_scalar(a, b, n, mode);\n";
+        out << "#endif\n";
+        out << "}\n";
+        out << "// Pairwise summation over 4-lane blocks: error grows with log(n) instead of n.\n";
+        out << inl << "double rox_pairwise_f64(const double* a, const double* b, size_t n) {\n";
+        out << "    if (n <= 256) return rox_sum_f64_block(a, b, n, 0);\n";
+        out << "    size_t half = (n / 2 + 3) & ~(size_t)3;\n";
+        out << "    return rox_pairwise_f64(a, b, half) + rox_pairwise_f64(a + half, b ? b + half : nullptr, n - half);\n";
+        out << "}\n";
+        out << inl << "double float64_sum(const std::vector<double>& xs) {\n";
+        out << "    return rox_pairwise_f64(xs.data(), nullptr, xs.size());\n";
+        out << "}\n";
+        out << inl << "double float64_sum_kahan(const std::vector<double>& xs) {\n";
+        out << "    return rox_sum_f64_block(xs.data(), nullptr, xs.size(), 1);\n";
+        out << "}\n";
+        out << inl << "rox_result<double> float64_dot(const std::vector<double>& a, const std::vector<double>& b) {\n";
+        out << "    if (a.size() != b.size()) return error<double>(\"Length mismatch\");\n";
+        out << "    return ok(rox_pairwise_f64(a.data(), b.data(), a.size()));\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("count_equal")) {
+        out << "// count_equal\n";
+        out << "template<typename T>\n";
+        out << "int64_t count_equal(const std::vector<T>& xs, T value) {\n";
+        out << "    int64_t n = 0;\n";
+        out << "    for (const auto& x : xs) n += (x == value);\n";
+        out << "    return n;\n";
+        out << "}\n";
+        out << "#if ROX_X86\n";
+        out << "__attribute__((target(\"avx2\")))\n";
+        out << inl << "int64_t rox_count_eq_i64_avx2(const int64_t* p, size_t n, int64_t value) {\n";
+        out << "    __m256i v = _mm256_set1_epi64x(value), acc = _mm256_setzero_si256();\n";
+        out << "    size_t i = 0;\n";
+        out << "    for (; i + 4 <= n; i += 4) {\n";
+        out << "        acc = _mm256_sub_epi64(acc, _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(p + i)), v));\n";
+        out << "    }\n";
+        out << "    alignas(32) int64_t lanes[4];\n";
+        out << "    _mm256_store_si256((__m256i*)lanes, acc);\n";
+        out << "    int64_t r = lanes[0] + lanes[1] + lanes[2] + lanes[3];\n";
+        out << "    for (; i < n; ++i) r += (p[i] == value);\n";
+        out << "    return r;\n";
+        out << "}\n";
+        out << "__attribute__((target(\"sse4.2\")))\n";
+        out << inl << "int64_t rox_count_eq_i64_sse42(const int64_t* p, size_t n, int64_t value) {\n";
+        out << "    __m128i v = _mm_set1_epi64x(value), acc = _mm_setzero_si128();\n";
+        out << "    size_t i = 0;\n";
+        out << "    for (; i + 2 <= n; i += 2) {\n";
+        out << "        acc = _mm_sub_epi64(acc, _mm_cmpeq_epi64(_mm_loadu_si128((const __m128i*)(p + i)), v));\n";
+        out << "    }\n";
+        out << "    alignas(16) int64_t lanes[2];\n";
+        out << "    _mm_store_si128((__m128i*)lanes, acc);\n";
+        out << "    int64_t r = lanes[0] + lanes[1];\n";
+        out << "    for (; i < n; ++i) r += (p[i] == value);\n";
+        out << "    return r;\n";
+        out << "}\n";
+        out << "#endif\n";
+        out << "template<>\n";
+        out << inl << "int64_t count_equal<int64_t>(const std::vector<int64_t>& xs, int64_t value) {\n";
+        out << "#if ROX_X86\n";
+        out << "    if (rox_has_avx2()) return rox_count_eq_i64_avx2(xs.data(), xs.size(), value);\n";
+        out << "    if (rox_has_sse42()) return rox_count_eq_i64_sse42(xs.data(), xs.size(), value);\n";
+        out << "#endif\n";
+        out << "    int64_t n = 0;\n";
+        out << "    for (int64_t x : xs) n += (x == value);\n";
+        out << "    return n;\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("sort")) {
+        out << "// Sorting: pattern-defeating quicksort for general element types,\n";
+        out << "// LSD radix sort for int64 / float64 / char.\n";
+        out << "template<typename T>\n";
+        out << "void rox_insertion_sort(T* first, T* last) {\n";
+        out << "    if (first == last) return;\n";
+        out << "    for (T* cur = first + 1; cur != last; ++cur) {\n";
+        out << "        if (*cur < *(cur - 1)) {\n";
+        out << "            T tmp = std::move(*cur);\n";
+        out << "            T* sift = cur;\n";
+        out << "            do { *sift = std::move(*(sift - 1)); --sift; } while (sift != first && tmp < *(sift - 1));\n";
+        out << "            *sift = std::move(tmp);\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Gives up after a fixed number of moves; used to finish nearly sorted partitions cheaply.\n";
+        out << "template<typename T>\n";
+        out << "bool rox_partial_insertion_sort(T* first, T* last) {\n";
+        out << "    if (first == last) return true;\n";
+        out << "    size_t moves = 0;\n";
+        out << "    for (T* cur = first + 1; cur != last; ++cur) {\n";
+        out << "        if (*cur < *(cur - 1)) {\n";
+        out << "            T tmp = std::move(*cur);\n";
+        out << "            T* sift = cur;\n";
+        out << "            do { *sift = std::move(*(sift - 1)); --sift; } while (sift != first && tmp < *(sift - 1));\n";
+        out << "            *sift = std::move(tmp);\n";
+        out << "            moves += cur - sift;\n";
+        out << "            if (moves > 8) return false;\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "    return true;\n";
+        out << "}\n";
+        out << "\n";
+        out << "template<typename T>\n";
+        out << "void rox_sort3(T* a, T* b, T* c) {\n";
+        out << "    if (*b < *a) std::swap(*a, *b);\n";
+        out << "    if (*c < *b) std::swap(*b, *c);\n";
+        out << "    if (*b < *a) std::swap(*a, *b);\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Partitions [first, last) around *first; elements equal to the pivot go right.\n";
+        out << "// Returns the pivot position and whether the range was already partitioned.\n";
+        out << "template<typename T>\n";
+        out << "std::pair<T*, bool> rox_partition_right(T* first, T* last) {\n";
+        out << "    T pivot = std::move(*first);\n";
+        out << "    T* lo = first;\n";
+        out << "    T* hi = last;\n";
+        out << "    while (*++lo < pivot) {}\n";
+        out << "    if (lo - 1 == first) { while (lo < hi && !(*--hi < pivot)) {} }\n";
+        out << "    else { while (!(*--hi < pivot)) {} }\n";
+        out << "    bool already = lo >= hi;\n";
+        out << "    while (lo < hi) {\n";
+        out << "        std::swap(*lo, *hi);\n";
+        out << "        while (*++lo < pivot) {}\n";
+        out << "        while (!(*--hi < pivot)) {}\n";
+        out << "    }\n";
+        out << "    T* pos = lo - 1;\n";
+        out << "    *first = std::move(*pos);\n";
+        out << "    *pos = std::move(pivot);\n";
+        out << "    return {pos, already};\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Partitions with elements equal to the pivot going left; used when the pivot\n";
+        out << "// equals the element before the range, which means the whole run of equal keys is skipped.\n";
+        out << "template<typename T>\n";
+        out << "T* rox_partition_left(T* first, T* last) {\n";
+        out << "    T pivot = std::move(*first);\n";
+        out << "    T* lo = first;\n";
+        out << "    T* hi = last;\n";
+        out << "    while (pivot < *--hi) {}\n";
+        out << "    if (hi + 1 == last) { while (lo < hi && !(pivot < *++lo)) {} }\n";
+        out << "    else { while (!(pivot < *++lo)) {} }\n";
+        out << "    while (lo < hi) {\n";
+        out << "        std::swap(*lo, *hi);\n";
+        out << "        while (pivot < *--hi) {}\n";
+        out << "        while (!(pivot < *++lo)) {}\n";
+        out << "    }\n";
+        out << "    T* pos = hi;\n";
+        out << "    *first = std::move(*pos);\n";
+        out << "    *pos = std::move(pivot);\n";
+        out << "    return pos;\n";
+        out << "}\n";
+        out << "\n";
+        out << "template<typename T>\n";
+        out << "void rox_pdqsort_loop(T* first, T* last, int badAllowed, bool leftmost) {\n";
+        out << "    while (true) {\n";
+        out << "        size_t n = last - first;\n";
+        out << "        if (n < 24) { rox_insertion_sort(first, last); return; }\n";
+        out << "\n";
+        out << "        // Median of three, or Tukey's ninther for large ranges; the median lands on *first.\n";
+        out << "        size_t half = n / 2;\n";
+        out << "        if (n > 128) {\n";
+        out << "            rox_sort3(first, first + half, last - 1);\n";
+        out << "            rox_sort3(first + 1, first + (half - 1), last - 2);\n";
+        out << "            rox_sort3(first + 2, first + (half + 1), last - 3);\n";
+        out << "            rox_sort3(first + (half - 1), first + half, first + (half + 1));\n";
+        out << "            std::swap(*first, *(first + half));\n";
+        out << "        } else {\n";
+        out << "            rox_sort3(first + half, first, last - 1);\n";
+        out << "        }\n";
+        out << "\n";
+        out << "        if (!leftmost && !(*(first - 1) < *first)) {\n";
+        out << "            first = rox_partition_left(first, last) + 1;\n";
+        out << "            continue;\n";
+        out << "        }\n";
+        out << "\n";
+        out << "        auto [pivot, already] = rox_partition_right(first, last);\n";
+        out << "        size_t lsize = pivot - first;\n";
+        out << "        size_t rsize = last - (pivot + 1);\n";
+        out << "        bool unbalanced = lsize < n / 8 || rsize < n / 8;\n";
+        out << "\n";
+        out << "        if (unbalanced) {\n";
+        out << "            if (--badAllowed == 0) {\n";
+        out << "                std::make_heap(first, last);\n";
+        out << "                std::sort_heap(first, last);\n";
+        out << "                return;\n";
+        out << "            }\n";
+        out << "            // Break up patterns that produced the bad split.\n";
+        out << "            if (lsize >= 24) {\n";
+        out << "                std::swap(*first, *(first + lsize / 4));\n";
+        out << "                std::swap(*(pivot - 1), *(pivot - lsize / 4));\n";
+        out << "            }\n";
+        out << "            if (rsize >= 24) {\n";
+        out << "                std::swap(*(pivot + 1), *(pivot + 1 + rsize / 4));\n";
+        out << "                std::swap(*(last - 1), *(last - rsize / 4));\n";
+        out << "            }\n";
+        out << "        } else if (already && rox_partial_insertion_sort(first, pivot) && rox_partial_insertion_sort(pivot + 1, last)) {\n";
+        out << "            return;\n";
+        out << "        }\n";
+        out << "\n";
+        out << "        rox_pdqsort_loop(first, pivot, badAllowed, leftmost);\n";
+        out << "        first = pivot + 1;\n";
+        out << "        leftmost = false;\n";
+        out << "    }\n";
+        out << "}\n";
+        out << "\n";
+        out << "template<typename T>\n";
+        out << "void rox_pdqsort(T* first, T* last) {\n";
+        out << "    size_t n = last - first;\n";
+        out << "    int log2n = 1;\n";
+        out << "    while (n >>= 1) ++log2n;\n";
+        out << "    rox_pdqsort_loop(first, last, log2n, true);\n";
+        out << "}\n";
+        out << "\n";
+        out << "// LSD radix sort over order-preserving unsigned keys. Passes whose byte is the\n";
+        out << "// same for every key are skipped.\n";
+        out << "template<typename T, typename A, typename KeyFn>\n";
+        out << "void rox_radix_sort(std::vector<T, A>& xs, KeyFn key) {\n";
+        out << "    size_t n = xs.size();\n";
+        out << "    if (n < 256) { rox_pdqsort(xs.data(), xs.data() + n); return; }\n";
+        out << "    using K = decltype(key(xs[0]));\n";
+        out << "    constexpr int bits = sizeof(K) > 1 ? 11 : 8;\n";
+        out << "    constexpr int radix = 1 << bits;\n";
+        out << "    constexpr int passes = (sizeof(K) * 8 + bits - 1) / bits;\n";
+        out << "    std::vector<size_t> counts(passes * radix, 0);\n";
+        out << "    for (const T& x : xs) {\n";
+        out << "        K k = key(x);\n";
+        out << "        for (int p = 0; p < passes; ++p) counts[p * radix + ((k >> (bits * p)) & (radix - 1))]++;\n";
+        out << "    }\n";
+        out << "    std::vector<T> buffer(n);\n";
+        out << "    T* src = xs.data();\n";
+        out << "    T* dst = buffer.data();\n";
+        out << "    for (int p = 0; p < passes; ++p) {\n";
+        out << "        size_t* c = &counts[p * radix];\n";
+        out << "        K first = (key(src[0]) >> (bits * p)) & (radix - 1);\n";
+        out << "        if (c[first] == n) continue;\n";
+        out << "        size_t sum = 0;\n";
+        out << "        for (int b = 0; b < radix; ++b) { size_t t = c[b]; c[b] = sum; sum += t; }\n";
+        out << "        for (size_t i = 0; i < n; ++i) dst[c[(key(src[i]) >> (bits * p)) & (radix - 1)]++] = src[i];\n";
+        out << "        std::swap(src, dst);\n";
+        out << "    }\n";
+        out << "    if (src != xs.data()) std::copy(src, src + n, xs.data());\n";
+        out << "}\n";
+        out << "\n";
+        out << inl << "uint64_t rox_radix_key(int64_t x) { return (uint64_t)x ^ (1ull << 63); }\n";
+        out << inl << "uint64_t rox_radix_key(double x) {\n";
+        out << "    uint64_t bits;\n";
+        out << "    std::memcpy(&bits, &x, sizeof bits);\n";
+        out << "    return (bits & (1ull << 63)) ? ~bits : bits | (1ull << 63);\n";
+        out << "}\n";
+        out << inl << "uint8_t rox_radix_key(char x) { return (uint8_t)((unsigned char)x ^ (std::is_signed_v<char> ? 0x80 : 0)); }\n";
+        out << "\n";
+        out << "template<typename T, typename A>\n";
+        out << "void rox_sort(std::vector<T, A>& xs) {\n";
+        out << "    rox_pdqsort(xs.data(), xs.data() + xs.size());\n";
+        out << "}\n";
+        out << "template<typename A>\n";
+        out << "void rox_sort(std::vector<int64_t, A>& xs) {\n";
+        out << "    rox_radix_sort(xs, [](int64_t x) { return rox_radix_key(x); });\n";
+        out << "}\n";
+        out << "template<typename A>\n";
+        out << "void rox_sort(std::vector<double, A>& xs) {\n";
+        out << "    rox_radix_sort(xs, [](double x) { return rox_radix_key(x); });\n";
+        out << "}\n";
+        out << "template<typename A>\n";
+        out << "void rox_sort(std::vector<char, A>& xs) {\n";
+        out << "    size_t counts[256] = {0};\n";
+        out << "    for (char c : xs) counts[rox_radix_key(c)]++;\n";
+        out << "    size_t i = 0;\n";
+        out << "    for (int b = 0; b < 256; ++b) {\n";
+        out << "        for (size_t k = 0; k < counts[b]; ++k) xs[i++] = (char)(unsigned char)(b ^ (std::is_signed_v<char> ? 0x80 : 0));\n";
+        out << "    }\n";
+        out << "}\n";
+        out << "template<typename A>\n";
+        out << "void rox_sort(std::vector<bool, A>& xs) {\n";
+        out << "    size_t falses = 0;\n";
+        out << "    for (bool b : xs) falses += !b;\n";
+        out << "    for (size_t i = 0; i < xs.size(); ++i) xs[i] = i >= falses;\n";
+        out << "}\n";
+        out << "\n";
+        out << "// sort_by: stable sort of a copy by keys computed once per element. Radix-sortable\n";
+        out << "// keys sort (key, index) pairs, which LSD radix keeps stable; other keys sort an\n";
+        out << "// index permutation with std::stable_sort.\n";
+        out << "template<typename K>\n";
+        out << "struct RoxKeyed { K key; uint32_t index; bool operator<(const RoxKeyed& o) const { return key < o.key; } };\n";
+        out << "\n";
+        out << "template<typename T, typename F>\n";
+        out << "std::vector<T> sort_by(const std::vector<T>& xs, F keyFn) {\n";
+        out << "    using K = std::decay_t<decltype(keyFn(xs[0]))>;\n";
+        out << "    std::vector<RoxKeyed<K>> keyed;\n";
+        out << "    keyed.reserve(xs.size());\n";
+        out << "    for (size_t i = 0; i < xs.size(); ++i) keyed.push_back({keyFn(xs[i]), (uint32_t)i});\n";
+        out << "    if constexpr (std::is_same_v<K, int64_t> || std::is_same_v<K, double> || std::is_same_v<K, char>) {\n";
+        out << "        if (keyed.size() >= 256) rox_radix_sort(keyed, [](const RoxKeyed<K>& k) { return rox_radix_key(k.key); });\n";
+        out << "        else std::stable_sort(keyed.begin(), keyed.end());\n";
+        out << "    } else {\n";
+        out << "        std::stable_sort(keyed.begin(), keyed.end());\n";
+        out << "    }\n";
+        out << "    std::vector<T> sorted;\n";
+        out << "    sorted.reserve(xs.size());\n";
+        out << "    for (const auto& k : keyed) sorted.push_back(xs[k.index]);\n";
+        out << "    return sorted;\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("small_list")) {
+        out << "// Result of a function that only returns short list literals: N inline slots,\n";
+        out << "// moved to a heap vector only if the list grows past them.\n";
+        out << "template<typename T, size_t N>\n";
+        out << "class RoxSmallList {\n";
+        out << "public:\n";
+        out << "    RoxSmallList() = default;\n";
+        out << "    RoxSmallList(std::initializer_list<T> items) {\n";
+        out << "        if (items.size() <= N) { std::copy(items.begin(), items.end(), slots); count = items.size(); }\n";
+        out << "        else { heap.assign(items.begin(), items.end()); spilled = true; }\n";
+        out << "    }\n";
+        out << "    size_t size() const { return spilled ? heap.size() : count; }\n";
+        out << "    T* begin() { return spilled ? heap.data() : slots; }\n";
+        out << "    T* end() { return begin() + size(); }\n";
+        out << "    const T* begin() const { return spilled ? heap.data() : slots; }\n";
+        out << "    const T* end() const { return begin() + size(); }\n";
+        out << "    T& operator[](size_t i) { return begin()[i]; }\n";
+        out << "    const T& operator[](size_t i) const { return begin()[i]; }\n";
+        out << "    void push_back(T x) {\n";
+        out << "        if (!spilled && count < N) { slots[count++] = std::move(x); return; }\n";
+        out << "        if (!spilled) {\n";
+        out << "            heap.reserve(2 * N);\n";
+        out << "            for (size_t i = 0; i < count; ++i) heap.push_back(std::move(slots[i]));\n";
+        out << "            spilled = true;\n";
+        out << "        }\n";
+        out << "        heap.push_back(std::move(x));\n";
+        out << "    }\n";
+        out << "    void pop_back() { if (spilled) heap.pop_back(); else if (count > 0) slots[--count] = T(); }\n";
+        out << "    std::vector<T> vec() const { return std::vector<T>(begin(), end()); }\n";
+        out << "private:\n";
+        out << "    T slots[N] = {};\n";
+        out << "    size_t count = 0;\n";
+        out << "    bool spilled = false;\n";
+        out << "    std::vector<T> heap;\n";
+        out << "};\n";
+        out << "\n";
+        if (has("access")) {
+            out << "template<typename T, size_t N>\n";
+            out << "rox_result<T> rox_at(const RoxSmallList<T, N>& xs, int64_t i) {\n";
+            out << "    if (i < 0 || i >= (int64_t)xs.size()) return error<T>(\"Index out of bounds\");\n";
+            out << "    return ok(xs[i]);\n";
+            out << "}\n";
+            out << "\n";
+            out << "template<typename T, size_t N>\n";
+            out << "rox_result<T> rox_at_unchecked(const RoxSmallList<T, N>& xs, int64_t i) {\n";
+            out << "    return {xs[i], RoxString()};\n";
+            out << "}\n";
+            out << "\n";
+            out << "template<typename T, size_t N>\n";
+            out << "void rox_set(RoxSmallList<T, N>& xs, int64_t i, T val) {\n";
+            out << "    if (i < 0 || i >= (int64_t)xs.size()) {\n";
+            out << "        rox_flush_stdout();\n";
+            out << "        std::cerr << \"Error: Index out of bounds in list.set\" << std::endl;\n";
+            out << "        exit(1);\n";
+            out << "    }\n";
+            out << "    xs[i] = val;\n";
+            out << "}\n";
+            out << "\n";
+        }
+        if (has("sort")) {
+            out << "template<typename T, size_t N>\n";
+            out << "void rox_sort(RoxSmallList<T, N>& xs) {\n";
+            out << "    rox_pdqsort(xs.begin(), xs.end());\n";
+            out << "}\n";
+            out << "\n";
+        }
+    }
+
+    if (has("pool")) {
+        out << "// Set while running a parallel loop chunk or a task; parallel loops started there run serially.\n";
+        out << inl << "thread_local bool rox_in_parallel = false;\n";
+        out << "// Index of the pool slot owned by this thread (0 for the main thread).\n";
+        out << inl << "thread_local int rox_worker = 0;\n";
+        out << "\n";
+        out << "// A spawned task. state goes 0 (queued) -> 1 (claimed) -> 2 (done); whoever claims it\n";
+        out << "// runs it: a pool worker, or the thread that joins it before anyone else got to it.\n";
+        out << "struct RoxTaskBase {\n";
+        out << "    std::atomic<int> state{0};\n";
+        out << "    virtual ~RoxTaskBase() = default;\n";
+        out << "    virtual void execute() = 0;\n";
+        out << "    bool claim() {\n";
+        out << "        int expected = 0;\n";
+        out << "        return state.compare_exchange_strong(expected, 1);\n";
+        out << "    }\n";
+        out << "    void runClaimed() {\n";
+        out << "        bool outer = rox_in_parallel;\n";
+        out << "        rox_in_parallel = true;\n";
+        out << "        execute();\n";
+        out << "        rox_in_parallel = outer;\n";
+        out << "        state.store(2);\n";
+        out << "        state.notify_all();\n";
+        out << "    }\n";
+        out << "};\n";
+        out << "\n";
+        out << "// Parallel loops and tasks: a work-stealing pool of ROX_THREADS workers (default: one\n";
+        out << "// per hardware thread). The calling thread works too. For loops, each worker owns a\n";
+        out << "// contiguous range of chunk indices, takes from its front and steals from the back of\n";
+        out << "// others. Spawned tasks go on the spawning thread's deque: the owner pops the newest,\n";
+        out << "// thieves take the oldest.\n";
+        out << "class RoxPool {\n";
+        out << "public:\n";
+        out << "    explicit RoxPool(int workers) : slots(workers) {\n";
+        out << "        for (int w = 1; w < workers; ++w) std::thread([this, w] { workerLoop(w); }).detach();\n";
+        out << "    }\n";
+        out << "    int size() const { return (int)slots.size(); }\n";
+        out << "\n";
+        out << "    // Runs task(c) for every c in [0, chunks) and returns when all have finished.\n";
+        out << "    void run(int64_t chunks, const std::function<void(int64_t)>& task) {\n";
+        out << "        int64_t lo = 0;\n";
+        out << "        for (int w = 0; w < size(); ++w) {\n";
+        out << "            int64_t hi = lo + chunks / size() + (w < chunks % size() ? 1 : 0);\n";
+        out << "            std::lock_guard<std::mutex> guard(slots[w].m);\n";
+        out << "            slots[w].lo = lo;\n";
+        out << "            slots[w].hi = hi;\n";
+        out << "            lo = hi;\n";
+        out << "        }\n";
+        out << "        pending.store(chunks);\n";
+        out << "        {\n";
+        out << "            std::lock_guard<std::mutex> lock(m);\n";
+        out << "            current = &task;\n";
+        out << "            ++generation;\n";
+        out << "        }\n";
+        out << "        wake.notify_all();\n";
+        out << "        work(0, task);\n";
+        out << "        std::unique_lock<std::mutex> lock(m);\n";
+        out << "        finished.wait(lock, [&] { return pending.load() == 0 && busy == 0; });\n";
+        out << "        current = nullptr;\n";
+        out << "    }\n";
+        out << "\n";
+        out << "    void submit(std::shared_ptr<RoxTaskBase> task) {\n";
+        out << "        {\n";
+        out << "            Slot& own = slots[rox_worker];\n";
+        out << "            std::lock_guard<std::mutex> guard(own.m);\n";
+        out << "            own.tasks.push_back(std::move(task));\n";
+        out << "        }\n";
+        out << "        queued.fetch_add(1);\n";
+        out << "        // Only pay for a wakeup when a worker is actually asleep.\n";
+        out << "        if (sleeping.load() > 0) {\n";
+        out << "            std::lock_guard<std::mutex> lock(m);\n";
+        out << "            wake.notify_one();\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "\n";
+        out << "    // Runs other tasks while waiting for target to finish.\n";
+        out << "    void helpUntil(RoxTaskBase& target) {\n";
+        out << "        std::shared_ptr<RoxTaskBase> task;\n";
+        out << "        while (target.state.load() != 2) {\n";
+        out << "            if (takeTask(rox_worker, task)) {\n";
+        out << "                if (task->claim()) task->runClaimed();\n";
+        out << "                task.reset();\n";
+        out << "            } else {\n";
+        out << "                target.state.wait(1);\n";
+        out << "            }\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "\n";
+        out << "    // Drops tasks that join() already ran from the newest end of this thread's deque.\n";
+        out << "    // Nothing else would pop them when no worker steals, e.g. with ROX_THREADS=1.\n";
+        out << "    void discardClaimed() {\n";
+        out << "        Slot& own = slots[rox_worker];\n";
+        out << "        std::lock_guard<std::mutex> guard(own.m);\n";
+        out << "        while (!own.tasks.empty() && own.tasks.back()->state.load() != 0) {\n";
+        out << "            own.tasks.pop_back();\n";
+        out << "            queued.fetch_sub(1);\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "\n";
+        out << "private:\n";
+        out << "    struct alignas(64) Slot {\n";
+        out << "        std::mutex m;\n";
+        out << "        int64_t lo = 0, hi = 0;\n";
+        out << "        std::deque<std::shared_ptr<RoxTaskBase>> tasks;\n";
+        out << "    };\n";
+        out << "    std::vector<Slot> slots;\n";
+        out << "    std::mutex m;\n";
+        out << "    std::condition_variable wake, finished;\n";
+        out << "    const std::function<void(int64_t)>* current = nullptr;\n";
+        out << "    uint64_t generation = 0;\n";
+        out << "    int busy = 0;\n";
+        out << "    std::atomic<int64_t> pending{0};\n";
+        out << "    std::atomic<int64_t> queued{0};\n";
+        out << "    std::atomic<int> sleeping{0};\n";
+        out << "\n";
+        out << "    bool take(int self, int64_t& chunk) {\n";
+        out << "        {\n";
+        out << "            Slot& own = slots[self];\n";
+        out << "            std::lock_guard<std::mutex> guard(own.m);\n";
+        out << "            if (own.lo < own.hi) { chunk = own.lo++; return true; }\n";
+        out << "        }\n";
+        out << "        for (int i = 1; i < size(); ++i) {\n";
+        out << "            Slot& victim = slots[(self + i) % size()];\n";
+        out << "            std::lock_guard<std::mutex> guard(victim.m);\n";
+        out << "            if (victim.lo < victim.hi) { chunk = --victim.hi; return true; }\n";
+        out << "        }\n";
+        out << "        return false;\n";
+        out << "    }\n";
+        out << "    void work(int self, const std::function<void(int64_t)>& task) {\n";
+        out << "        int64_t chunk;\n";
+        out << "        while (take(self, chunk)) {\n";
+        out << "            task(chunk);\n";
+        out << "            pending.fetch_sub(1);\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "    bool takeTask(int self, std::shared_ptr<RoxTaskBase>& task) {\n";
+        out << "        if (queued.load() == 0) return false;\n";
+        out << "        {\n";
+        out << "            Slot& own = slots[self];\n";
+        out << "            std::lock_guard<std::mutex> guard(own.m);\n";
+        out << "            if (!own.tasks.empty()) {\n";
+        out << "                task = std::move(own.tasks.back());\n";
+        out << "                own.tasks.pop_back();\n";
+        out << "                queued.fetch_sub(1);\n";
+        out << "                return true;\n";
+        out << "            }\n";
+        out << "        }\n";
+        out << "        for (int i = 1; i < size(); ++i) {\n";
+        out << "            Slot& victim = slots[(self + i) % size()];\n";
+        out << "            std::lock_guard<std::mutex> guard(victim.m);\n";
+        out << "            if (!victim.tasks.empty()) {\n";
+        out << "                task = std::move(victim.tasks.front());\n";
+        out << "                victim.tasks.pop_front();\n";
+        out << "                queued.fetch_sub(1);\n";
+        out << "                return true;\n";
+        out << "            }\n";
+        out << "        }\n";
+        out << "        return false;\n";
+        out << "    }\n";
+        out << "    void workerLoop(int self) {\n";
+        out << "        rox_worker = self;\n";
+        out << "        uint64_t seen = 0;\n";
+        out << "        std::shared_ptr<RoxTaskBase> spawned;\n";
+        out << "        while (true) {\n";
+        out << "            const std::function<void(int64_t)>* task = nullptr;\n";
+        out << "            {\n";
+        out << "                std::unique_lock<std::mutex> lock(m);\n";
+        out << "                ++sleeping;\n";
+        out << "                wake.wait(lock, [&] { return generation != seen || queued.load() > 0; });\n";
+        out << "                --sleeping;\n";
+        out << "                if (generation != seen) {\n";
+        out << "                    seen = generation;\n";
+        out << "                    task = current; // null if that loop already finished\n";
+        out << "                    if (task) ++busy;\n";
+        out << "                }\n";
+        out << "            }\n";
+        out << "            if (task) {\n";
+        out << "                work(self, *task);\n";
+        out << "                {\n";
+        out << "                    std::lock_guard<std::mutex> lock(m);\n";
+        out << "                    --busy;\n";
+        out << "                }\n";
+        out << "                finished.notify_all();\n";
+        out << "            }\n";
+        out << "            while (takeTask(self, spawned)) {\n";
+        out << "                if (spawned->claim()) spawned->runClaimed();\n";
+        out << "                spawned.reset();\n";
+        out << "            }\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "};\n";
+        out << "\n";
+        out << "// Never destroyed: a runtime error may exit() from inside a worker.\n";
+        out << inl << "RoxPool& rox_pool() {\n";
+        out << "    static RoxPool* pool = [] {\n";
+        out << "        const char* env = std::getenv(\"ROX_THREADS\");\n";
+        out << "        int n = env ? std::atoi(env) : 0;\n";
+        out << "        if (n <= 0) n = (int)std::thread::hardware_concurrency();\n";
+        out << "        return new RoxPool(n > 0 ? n : 1);\n";
+        out << "    }();\n";
+        out << "    return *pool;\n";
+        out << "}\n";
+        out << "\n";
+        out << "// Chunking depends only on the trip count: at most 4096 chunks.\n";
+        out << inl << "int64_t rox_parallel_grain(int64_t n) { return n <= 4096 ? 1 : (n + 4095) / 4096; }\n";
+        out << inl << "int64_t rox_parallel_chunks(int64_t n) { return n <= 0 ? 0 : (n + rox_parallel_grain(n) - 1) / rox_parallel_grain(n); }\n";
+        out << "\n";
+        out << "template<typename T> T rox_min_identity() { return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity() : std::numeric_limits<T>::max(); }\n";
+        out << "template<typename T> T rox_max_identity() { return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::lowest(); }\n";
+        out << "\n";
+        out << "// Calls body(chunk, lo, hi) over [0, n). Nested parallel loops run serially.\n";
+        out << "template<typename F>\n";
+        out << "void rox_parallel_for(int64_t n, F body) {\n";
+        out << "    const int64_t grain = rox_parallel_grain(n);\n";
+        out << "    const int64_t chunks = rox_parallel_chunks(n);\n";
+        out << "    auto runChunk = [&](int64_t c) { body(c, c * grain, std::min(n, (c + 1) * grain)); };\n";
+        out << "    if (chunks <= 1 || rox_in_parallel || rox_pool().size() == 1) {\n";
+        out << "        for (int64_t c = 0; c < chunks; ++c) runChunk(c);\n";
+        out << "        return;\n";
+        out << "    }\n";
+        out << "    rox_pool().run(chunks, [&](int64_t c) {\n";
+        out << "        rox_in_parallel = true;\n";
+        out << "        runChunk(c);\n";
+        out << "        rox_in_parallel = false;\n";
+        out << "    });\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("tasks")) {
+        out << "// task[T]: spawn(fn, args...) copies the arguments and queues fn on the pool;\n";
+        out << "// join(t) returns its result, running it on the spot if no worker has started it.\n";
+        out << "template<typename R>\n";
+        out << "struct RoxTaskResult : RoxTaskBase {\n";
+        out << "    std::optional<R> value;\n";
+        out << "};\n";
+        out << "\n";
+        out << "template<typename R, typename F, typename... Args>\n";
+        out << "struct RoxTaskCall : RoxTaskResult<R> {\n";
+        out << "    F fn;\n";
+        out << "    std::tuple<Args...> args;\n";
+        out << "    RoxTaskCall(F fn, Args... args) : fn(fn), args(std::move(args)...) {}\n";
+        out << "    void execute() override { this->value.emplace(std::apply(fn, args)); }\n";
+        out << "};\n";
+        out << "\n";
+        out << "template<typename R>\n";
+        out << "struct RoxTask {\n";
+        out << "    std::shared_ptr<RoxTaskResult<R>> state;\n";
+        out << "};\n";
+        out << "\n";
+        out << "template<typename F, typename... Args>\n";
+        out << "auto spawn(F fn, Args... args) {\n";
+        out << "    using R = std::decay_t<std::invoke_result_t<F&, Args&...>>;\n";
+        out << "    auto task = std::make_shared<RoxTaskCall<R, F, Args...>>(fn, std::move(args)...);\n";
+        out << "    rox_pool().submit(task);\n";
+        out << "    return RoxTask<R>{std::move(task)};\n";
+        out << "}\n";
+        out << "\n";
+        out << "template<typename R>\n";
+        out << "R join(const RoxTask<R>& t) {\n";
+        out << "    if (!t.state) {\n";
+        out << "        rox_flush_stdout();\n";
+        out << "        std::cerr << \"Runtime Error: join() on a task that was never spawned.\" << std::endl;\n";
+        out << "        exit(1);\n";
+        out << "    }\n";
+        out << "    if (t.state->claim()) {\n";
+        out << "        t.state->runClaimed();\n";
+        out << "        rox_pool().discardClaimed();\n";
+        out << "    } else {\n";
+        out << "        rox_pool().helpUntil(*t.state);\n";
+        out << "    }\n";
+        out << "    return *t.state->value;\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("parallel_list")) {
+        out << "// parallel_map / parallel_filter / parallel_reduce: list builtins on the same pool and\n";
+        out << "// chunking as parallel for. Short lists run serially. Output order always matches\n";
+        out << "// the input order.\n";
+        out << "constexpr int64_t rox_parallel_min_size = 4096;\n";
+        out << "\n";
+        out << "template<typename T, typename F>\n";
+        out << "auto parallel_map(const std::vector<T>& xs, F fn) {\n";
+        out << "    using R = std::decay_t<decltype(fn(xs[0]))>;\n";
+        out << "    const int64_t n = (int64_t)xs.size();\n";
+        out << "    // vector<bool> packs bits, so neighbouring chunks would race on shared words.\n";
+        out << "    using Slot = std::conditional_t<std::is_same_v<R, bool>, char, R>;\n";
+        out << "    std::vector<Slot> out(n);\n";
+        out << "    if (n < rox_parallel_min_size) {\n";
+        out << "        for (int64_t i = 0; i < n; ++i) out[i] = fn(xs[i]);\n";
+        out << "    } else {\n";
+        out << "        rox_parallel_for(n, [&](int64_t, int64_t lo, int64_t hi) {\n";
+        out << "            for (int64_t i = lo; i < hi; ++i) out[i] = fn(xs[i]);\n";
+        out << "        });\n";
+        out << "    }\n";
+        out << "    if constexpr (std::is_same_v<R, bool>) return std::vector<bool>(out.begin(), out.end());\n";
+        out << "    else return out;\n";
+        out << "}\n";
+        out << "\n";
+        out << "template<typename T, typename F>\n";
+        out << "std::vector<T> parallel_filter(const std::vector<T>& xs, F pred) {\n";
+        out << "    const int64_t n = (int64_t)xs.size();\n";
+        out << "    std::vector<T> out;\n";
+        out << "    if (n < rox_parallel_min_size) {\n";
+        out << "        for (const T& x : xs) if (pred(x)) out.push_back(x);\n";
+        out << "        return out;\n";
+        out << "    }\n";
+        out << "    std::vector<std::vector<T>> kept(rox_parallel_chunks(n));\n";
+        out << "    rox_parallel_for(n, [&](int64_t c, int64_t lo, int64_t hi) {\n";
+        out << "        for (int64_t i = lo; i < hi; ++i) if (pred(xs[i])) kept[c].push_back(xs[i]);\n";
+        out << "    });\n";
+        out << "    size_t total = 0;\n";
+        out << "    for (const auto& k : kept) total += k.size();\n";
+        out << "    out.reserve(total);\n";
+        out << "    for (auto& k : kept) out.insert(out.end(), std::make_move_iterator(k.begin()), std::make_move_iterator(k.end()));\n";
+        out << "    return out;\n";
+        out << "}\n";
+        out << "\n";
+        out << "// combine must be associative: each chunk folds its own elements, then init and the\n";
+        out << "// chunk results are folded left to right. Chunk results are combined like elements,\n";
+        out << "// so init, combine's parameters and its result all have the element type.\n";
+        out << "template<typename T, typename F>\n";
+        out << "T parallel_reduce(const std::vector<T>& xs, std::type_identity_t<T> init, F combine) {\n";
+        out << "    const int64_t n = (int64_t)xs.size();\n";
+        out << "    if (n < rox_parallel_min_size) {\n";
+        out << "        for (const T& x : xs) init = combine(init, x);\n";
+        out << "        return init;\n";
+        out << "    }\n";
+        out << "    std::vector<T> partial(rox_parallel_chunks(n));\n";
+        out << "    rox_parallel_for(n, [&](int64_t c, int64_t lo, int64_t hi) {\n";
+        out << "        T acc = xs[lo];\n";
+        out << "        for (int64_t i = lo + 1; i < hi; ++i) acc = combine(acc, xs[i]);\n";
+        out << "        partial[c] = acc;\n";
+        out << "    });\n";
+        out << "    for (const T& p : partial) init = combine(init, p);\n";
+        out << "    return init;\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("stdin")) {
+        out << "// Block-buffered stdin shared by read_line, read_int64, read_float64 and stdin_lines.\n";
+        out << "// Refills with read(2) in 1 MiB chunks; the buffer grows only for longer lines.\n";
+        out << "struct RoxIn {\n";
+        out << "    std::vector<char> buf = std::vector<char>(1 << 20);\n";
+        out << "    size_t pos = 0, end = 0;\n";
+        out << "    bool eof = false;\n";
+        out << "    // Set while a stdin_lines loop variable points into buf. The next fill() then moves\n";
+        out << "    // the unread input to a new buffer and keeps the old one in `retired`, so reads in\n";
+        out << "    // the loop body cannot overwrite the current line.\n";
+        out << "    bool viewed = false;\n";
+        out << "    std::vector<char> retired;\n";
+        out << "\n";
+        out << "    void fill() {\n";
+        out << "        rox_flush_stdout();\n";
+        out << "        if (viewed) {\n";
+        out << "            std::vector<char> next(end - pos == buf.size() ? buf.size() * 2 : buf.size());\n";
+        out << "            std::memcpy(next.data(), buf.data() + pos, end - pos);\n";
+        out << "            retired = std::move(buf);\n";
+        out << "            buf = std::move(next);\n";
+        out << "            end -= pos;\n";
+        out << "            pos = 0;\n";
+        out << "            viewed = false;\n";
+        out << "        } else if (pos > 0) {\n";
+        out << "            std::memmove(buf.data(), buf.data() + pos, end - pos);\n";
+        out << "            end -= pos;\n";
+        out << "            pos = 0;\n";
+        out << "        }\n";
+        out << "        if (end == buf.size()) buf.resize(buf.size() * 2);\n";
+        out << "        while (true) {\n";
+        out << "            ssize_t r = ::read(0, buf.data() + end, buf.size() - end);\n";
+        out << "            if (r < 0 && errno == EINTR) continue;\n";
+        out << "            if (r <= 0) eof = true;\n";
+        out << "            else end += (size_t)r;\n";
+        out << "            return;\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "\n";
+        out << "    // Next line without its '\\n'; the view is valid until the next read.\n";
+        out << "    bool nextLine(const char*& p, size_t& n) {\n";
+        out << "        while (true) {\n";
+        out << "            const char* start = buf.data() + pos;\n";
+        out << "            const char* nl = (const char*)std::memchr(start, '\\n', end - pos);\n";
+        out << "            if (nl) {\n";
+        out << "                p = start;\n";
+        out << "                n = nl - start;\n";
+        out << "                pos += n + 1;\n";
+        out << "                return true;\n";
+        out << "            }\n";
+        out << "            if (eof) {\n";
+        out << "                if (pos == end) return false;\n";
+        out << "                p = start;\n";
+        out << "                n = end - pos;\n";
+        out << "                pos = end;\n";
+        out << "                return true;\n";
+        out << "            }\n";
+        out << "            fill();\n";
+        out << "        }\n";
+        out << "    }\n";
+        out << "\n";
+        out << "    // Next whitespace-delimited token.\n";
+        out << "    bool nextToken(const char*& p, size_t& n) {\n";
+        out << "        auto space = [](char c) { return c == ' ' || c == '\\n' || c == '\\t' || c == '\\r'; };\n";
+        out << "        while (true) {\n";
+        out << "            while (pos < end && space(buf[pos])) ++pos;\n";
+        out << "            if (pos < end) break;\n";
+        out << "            if (eof) return false;\n";
+        out << "            fill();\n";
+        out << "        }\n";
+        out << "        size_t i = pos;\n";
+        out << "        while (true) {\n";
+        out << "            while (i < end && !space(buf[i])) ++i;\n";
+        out << "            if (i < end || eof) break;\n";
+        out << "            size_t offset = i - pos;\n";
+        out << "            fill();\n";
+        out << "            i = pos + offset;\n";
+        out << "        }\n";
+        out << "        p = buf.data() + pos;\n";
+        out << "        n = i - pos;\n";
+        out << "        pos = i;\n";
+        out << "        return true;\n";
+        out << "    }\n";
+        out << "};\n";
+        out << inl << "RoxIn rox_in;\n";
+        out << "\n";
+        out << "// read_line: reads one line from stdin\n";
+        out << inl << "rox_result<RoxString> read_line() {\n";
+        out << "    const char* p;\n";
+        out << "    size_t n;\n";
+        out << "    if (!rox_in.nextLine(p, n)) return error<RoxString>(\"EOF\");\n";
+        out << "    return ok(RoxString(std::string(p, n)));\n";
+        out << "}\n";
+        out << "\n";
+        out << "template<typename T>\n";
+        out << "rox_result<T> rox_read_number(const char* invalid) {\n";
+        out << "    const char* p;\n";
+        out << "    size_t n;\n";
+        out << "    if (!rox_in.nextToken(p, n)) return error<T>(\"EOF\");\n";
+        out << "    T v{};\n";
+        out << "    auto [last, ec] = std::from_chars(p, p + n, v);\n";
+        out << "    if (ec != std::errc() || last != p + n) return error<T>(invalid);\n";
+        out << "    return ok(v);\n";
+        out << "}\n";
+        out << inl << "rox_result<int64_t> read_int64() { return rox_read_number<int64_t>(\"Invalid int64\"); }\n";
+        out << inl << "rox_result<double> read_float64() { return rox_read_number<double>(\"Invalid float64\"); }\n";
+        out << "\n";
+    }
+
+    if (has("line")) {
+        out << "// A line of stdin viewed in place; converts to string when stored.\n";
+        out << "struct RoxLine {\n";
+        out << "    const char* ptr;\n";
+        out << "    size_t len;\n";
+        out << "    int64_t size() const { return (int64_t)len; }\n";
+        out << "    operator RoxString() const { return RoxString(std::string(ptr, len)); }\n";
+        out << "    bool operator==(const RoxString& s) const { return s.val.size() == len && std::memcmp(ptr, s.val.data(), len) == 0; }\n";
+        out << "    bool operator!=(const RoxString& s) const { return !(*this == s); }\n";
+        out << "};\n";
+        out << inl << "void rox_write(const RoxLine& s) { rox_out.put(s.ptr, s.len); }\n";
+        out << inl << "rox_result<char> rox_at(const RoxLine& s, int64_t i) {\n";
+        out << "    if (i < 0 || i >= s.size()) return error<char>(\"Index out of bounds\");\n";
+        out << "    return ok(s.ptr[i]);\n";
+        out << "}\n";
+        out << inl << "rox_result<char> rox_at_unchecked(const RoxLine& s, int64_t i) {\n";
+        out << "    return {s.ptr[i], RoxString()};\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("stdin_lines")) {
+        out << "struct RoxStdinLines {\n";
+        out << "    struct Iterator {\n";
+        out << "        RoxLine line;\n";
+        out << "        bool done;\n";
+        out << "        Iterator& operator++() {\n";
+        out << "            rox_in.viewed = false;\n";
+        out << "            done = !rox_in.nextLine(line.ptr, line.len);\n";
+        out << "            rox_in.viewed = !done;\n";
+        out << "            return *this;\n";
+        out << "        }\n";
+        out << "        const RoxLine& operator*() const { return line; }\n";
+        out << "        bool operator!=(const Iterator& other) const { return done != other.done; }\n";
+        out << "    };\n";
+        out << "    Iterator begin() { Iterator it{{nullptr, 0}, false}; return ++it; }\n";
+        out << "    Iterator end() { return {{nullptr, 0}, true}; }\n";
+        out << "};\n";
+        out << inl << "RoxStdinLines stdin_lines() { return {}; }\n";
+        out << "\n";
+    }
+
+    if (has("read_file")) {
+        out << "// Files\n";
+        out << inl << "rox_result<RoxString> read_file(const RoxString& path) {\n";
+        out << "    int fd = ::open(path.val.c_str(), O_RDONLY);\n";
+        out << "    if (fd < 0) return error<RoxString>(std::strerror(errno));\n";
+        out << "    std::string data;\n";
+        out << "    struct stat st;\n";
+        out << "    if (::fstat(fd, &st) == 0 && st.st_size > 0) data.reserve((size_t)st.st_size);\n";
+        out << "    char chunk[1 << 16];\n";
+        out << "    while (true) {\n";
+        out << "        ssize_t r = ::read(fd, chunk, sizeof chunk);\n";
+        out << "        if (r < 0 && errno == EINTR) continue;\n";
+        out << "        if (r < 0) { int err = errno; ::close(fd); return error<RoxString>(std::strerror(err)); }\n";
+        out << "        if (r == 0) break;\n";
+        out << "        data.append(chunk, (size_t)r);\n";
+        out << "    }\n";
+        out << "    ::close(fd);\n";
+        out << "    return ok(RoxString(std::move(data)));\n";
+        out << "}\n";
+        out << "\n";
+    }
+
+    if (has("file_view")) {
+        out << "// file_view: a read-only memory mapping. Copies and slices share the mapping,\n";
+        out << "// which is unmapped when the last of them goes away.\n";
+        out << "struct RoxFileView {\n";
+        out << "    std::shared_ptr<const char> mapping;\n";
+        out << "    const char* ptr = nullptr;\n";
+        out << "    size_t len = 0;\n";
+        out << "\n";
+        out << "    int64_t size() const { return (int64_t)len; }\n";
+        out << "    operator RoxString() const { return RoxString(std::string(ptr, len)); }\n";
+        out << "    bool operator==(const RoxString& s) const { return s.val.size() == len && std::memcmp(ptr, s.val.data(), len) == 0; }\n";
+        out << "    bool operator!=(const RoxString& s) const { return !(*this == s); }\n";
+        out << "\n";
+        out << "    rox_result<RoxFileView> slice(int64_t start, int64_t end) const {\n";
+        out << "        if (start < 0 || end < start || end > size()) return error<RoxFileView>(\"Index out of bounds\");\n";
+        out << "        return ok(RoxFileView{mapping, ptr + start, (size_t)(end - start)});\n";
+        out << "    }\n";
+        out << "\n";
+        out << "    struct Lines {\n";
+        out << "        std::shared_ptr<const char> mapping; // keeps a temporary view's file mapped during the loop\n";
+        out << "        const char* begin_;\n";
+        out << "        const char* end_;\n";
+        out << "        struct Iterator {\n";
+        out << "            const char* next;\n";
+        out << "            const char* end;\n";
+        out << "            RoxLine line;\n";
+        out << "            bool done;\n";
+        out << "            Iterator& operator++() {\n";
+        out << "                if (next == end) { done = true; return *this; }\n";
+        out << "                const char* nl = (const char*)std::memchr(next, '\\n', end - next);\n";
+        out << "                const char* stop = nl ? nl : end;\n";
+        out << "                line = {next, (size_t)(stop - next)};\n";
+        out << "                next = nl ? nl + 1 : end;\n";
+        out << "                return *this;\n";
+        out << "            }\n";
+        out << "            const RoxLine& operator*() const { return line; }\n";
+        out << "            bool operator!=(const Iterator& other) const { return done != other.done; }\n";
+        out << "        };\n";
+        out << "        Iterator begin() const { Iterator it{begin_, end_, {nullptr, 0}, false}; return ++it; }\n";
+        out << "        Iterator end() const { return {end_, end_, {nullptr, 0}, true}; }\n";
+        out << "    };\n";
+        out << "    Lines lines() const { return {mapping, ptr, ptr + len}; }\n";
+        out << "};\n";
+        out << inl << "void rox_write(const RoxFileView& v) { rox_out.put(v.ptr, v.len); }\n";
+        out << inl << "rox_result<char> rox_at(const RoxFileView& v, int64_t i) {\n";
+        out << "    if (i < 0 || i >= v.size()) return error<char>(\"Index out of bounds\");\n";
+        out << "    return ok(v.ptr[i]);\n";
+        out << "}\n";
+        out << inl << "rox_result<char> rox_at_unchecked(const RoxFileView& v, int64_t i) {\n";
+        out << "    return {v.ptr[i], RoxString()};\n";
+        out << "}\n";
+        out << "\n";
+        out << inl << "rox_result<RoxFileView> map_file(const RoxString& path) {\n";
+        out << "    int fd = ::open(path.val.c_str(), O_RDONLY);\n";
+        out << "    if (fd < 0) return error<RoxFileView>(std::strerror(errno));\n";
+        out << "    struct stat st;\n";
+        out << "    if (::fstat(fd, &st) != 0) { int err = errno; ::close(fd); return error<RoxFileView>(std::strerror(err)); }\n";
+        out << "    size_t len = (size_t)st.st_size;\n";
+        out << "    if (len == 0) { ::close(fd); return ok(RoxFileView{}); }\n";
+        out << "    void* addr = ::mmap(nullptr, len, PROT_READ, MAP_PRIVATE, fd, 0);\n";
+        out << "    int err = errno;\n";
+        out << "    ::close(fd);\n";
+        out << "    if (addr == MAP_FAILED) return error<RoxFileView>(std::strerror(err));\n";
+        out << "    ::madvise(addr, len, MADV_SEQUENTIAL);\n";
+        out << "    std::shared_ptr<const char> mapping((const char*)addr, [len](const char* p) { ::munmap((void*)p, len); });\n";
+        out << "    return ok(RoxFileView{mapping, (const char*)addr, len});\n";
+        out << "}\n";
+    }
 
     out << "\n// End Runtime\n\n";
+    preambleSize = (size_t)(out.tellp() - start);
+}
+
+std::string Codegen::runtimeHeader() {
+    inlineDefinitions = true;
+    std::unordered_set<std::string> uses;
+    for (const auto& fragment : runtimeFragments()) uses.insert(fragment.first);
+    runtimeUses.swap(uses);
+    std::stringstream runtime;
+    out.swap(runtime);
+    emitPreamble();
+    out.swap(runtime);
+    runtimeUses.swap(uses);
+    return "#ifndef ROX_RUNTIME_H\n#define ROX_RUNTIME_H\n" + runtime.str() + "#endif\n";
 }
 
 void Codegen::genStmt(Stmt* stmt) {
     if (!stmt) {
         return;
     }
+    if (int l = lineOf(stmt)) line = l;
     if (auto* s = dynamic_cast<BlockStmt*>(stmt)) genBlock(s);
     else if (auto* s = dynamic_cast<IfStmt*>(stmt)) genIf(s);
     else if (auto* s = dynamic_cast<ForStmt*>(stmt)) genFor(s);
@@ -374,6 +2375,7 @@ void Codegen::genExpr(Expr* expr) {
     else if (auto* e = dynamic_cast<FieldAccessExpr*>(expr)) genFieldAccess(e);
     else if (auto* e = dynamic_cast<FieldAssignExpr*>(expr)) genFieldAssign(e);
     else if (auto* e = dynamic_cast<DefaultExpr*>(expr)) genDefault(e);
+    else if (auto* e = dynamic_cast<OkExpr*>(expr)) genOk(e);
     else emit("/* Unknown expr */");
 }
 
@@ -387,20 +2389,33 @@ void Codegen::genType(Type* type) {
         else if (s == "bool") out << "bool";
         else if (s == "char") out << "char";
         else if (s == "string") out << "RoxString";
+        else if (s == "file_view") {
+            runtimeUses.insert("file_view");
+            out << "RoxFileView";
+        }
         else if (s == "none") out << "None";
         else out << s; // Fallback
+    } else if (auto* t = dynamic_cast<SoaListType*>(type)) {
+        out << "RoxSoa_" << t->elementType->toString();
     } else if (auto* t = dynamic_cast<ListType*>(type)) {
         out << "std::vector<";
         genType(t->elementType.get());
         out << ">";
+    } else if (auto* t = dynamic_cast<TaskType*>(type)) {
+        runtimeUses.insert("tasks");
+        out << "RoxTask<";
+        genType(t->resultType.get());
+        out << ">";
     } else if (auto* t = dynamic_cast<DictionaryType*>(type)) {
+        runtimeUses.insert("dict");
         out << "std::unordered_map<";
         genType(t->keyType.get());
         out << ", ";
         genType(t->valueType.get());
         out << ">";
     } else if (auto* t = dynamic_cast<FunctionType*>(type)) {
-        out << "std::function<";
+        runtimeUses.insert("function");
+        out << "RoxFn<";
         genType(t->returnType.get());
         out << "(";
         for (size_t i = 0; i < t->paramTypes.size(); ++i) {
@@ -417,9 +2432,21 @@ void Codegen::genType(Type* type) {
     }
 }
 
+// Declares the block's arena ahead of any collection that allocates from it.
+void Codegen::emitArenaFor(const std::vector<std::unique_ptr<Stmt>>& statements) {
+    for (const auto& s : statements) {
+        if (arenaLets.count(dynamic_cast<LetStmt*>(s.get()))) {
+            runtimeUses.insert("arena");
+            emitLine("RoxArena roxv26__arena;");
+            return;
+        }
+    }
+}
+
 void Codegen::genBlock(BlockStmt* stmt) {
     emitLine("{");
     indentLevel++;
+    emitArenaFor(stmt->statements);
     for (const auto& s : stmt->statements) {
         genStmt(s.get());
     }
@@ -484,6 +2511,9 @@ void Codegen::genIf(IfStmt* stmt) {
         }
     }
 
+    std::vector<std::string> nonZeroIfTrue, nonZeroIfFalse;
+    nonZeroFacts(stmt->condition.get(), nonZeroIfTrue, nonZeroIfFalse);
+
     emitIndent();
     out << "if (";
     genExpr(stmt->condition.get());
@@ -491,13 +2521,16 @@ void Codegen::genIf(IfStmt* stmt) {
 
     // Enter scope for then branch
     enterScope();
+    proveNonZero(nonZeroIfTrue);
 
     // Case A: if (isOk(x)) { ... }
     // Refine x in THEN branch
     if (!verifiedVarName.empty() && !isNegated) {
         VarInfo* outer = resolveVar(verifiedVarName);
         if (outer) {
-            scopes.back()[verifiedVarName] = {outer->type, true}; // Shadow with proven ok
+            VarInfo refined = *outer;
+            refined.isProvenOk = true;
+            scopes.back()[verifiedVarName] = refined; // Shadow with proven ok
         }
     }
 
@@ -510,13 +2543,16 @@ void Codegen::genIf(IfStmt* stmt) {
 
         // Enter scope for else branch
         enterScope();
+        proveNonZero(nonZeroIfFalse);
 
         // Case B: if (not(isOk(x))) { ... } else { ... }
         // Refine x in ELSE branch
         if (!verifiedVarName.empty() && isNegated) {
             VarInfo* outer = resolveVar(verifiedVarName);
             if (outer) {
-                scopes.back()[verifiedVarName] = {outer->type, true};
+                VarInfo refined = *outer;
+                refined.isProvenOk = true;
+                scopes.back()[verifiedVarName] = refined;
             }
         }
 
@@ -532,49 +2568,480 @@ void Codegen::genIf(IfStmt* stmt) {
             refineVar(verifiedVarName);
         }
     }
+
+    // Same for divisors: if (d == 0) { return; }
+    if (isTerminal(stmt->thenBranch.get())) proveNonZero(nonZeroIfFalse);
+    if (stmt->elseBranch && isTerminal(stmt->elseBranch.get())) proveNonZero(nonZeroIfTrue);
+}
+
+// Reads a literal range() step such as `2` or `-1`.
+static bool literalStep(Expr* expr, int64_t& step) {
+    bool negate = false;
+    if (auto* unary = dynamic_cast<UnaryExpr*>(expr)) {
+        if (unary->op.type != TokenType::MINUS) return false;
+        negate = true;
+        expr = unary->right.get();
+    }
+    auto* lit = dynamic_cast<LiteralExpr*>(expr);
+    if (!lit || lit->value.type != TokenType::NUMBER_INT) return false;
+    try {
+        step = std::stoll(lit->value.lexeme);
+    } catch (const std::out_of_range&) {
+        return false;
+    }
+    if (negate) step = -step;
+    return true;
+}
+
+// range(start, end, step) with literal start and step of the same sign never yields 0.
+static bool rangeAvoidsZero(CallExpr* rangeCall) {
+    int64_t start = 0, step = 0;
+    return literalStep(rangeCall->arguments[0].get(), start) && literalStep(rangeCall->arguments[2].get(), step) &&
+           ((start > 0 && step > 0) || (start < 0 && step < 0));
 }
 
 void Codegen::genFor(ForStmt* stmt) {
+    CallExpr* rangeCall = nullptr;
     // Compile-time validation: check for literal step=0 in range() calls
     if (auto* call = dynamic_cast<CallExpr*>(stmt->iterable.get())) {
         auto* callee = dynamic_cast<VariableExpr*>(call->callee.get());
         if (callee && callee->name.lexeme == "range") {
             if (call->arguments.size() != 3) {
-                std::cerr << "Error: range() requires exactly 3 arguments: range(start, end, step)." << std::endl;
-                exit(1);
+                errorOut << "Error: range() requires exactly 3 arguments: range(start, end, step)." << std::endl;
+                fail();
             }
             // Check for literal 0 step
-            if (auto* lit = dynamic_cast<LiteralExpr*>(call->arguments[2].get())) {
-                if (lit->value.type == TokenType::NUMBER_INT && lit->value.lexeme == "0") {
-                    std::cerr << "Error: range() step cannot be 0." << std::endl;
-                    exit(1);
-                }
+            int64_t step = 0;
+            if (literalStep(call->arguments[2].get(), step) && step == 0) {
+                errorOut << "Error: range() step cannot be 0." << std::endl;
+                fail();
             }
+            rangeCall = call;
         }
     }
 
-    emitIndent();
-    out << "for (auto " << sanitize(stmt->iterator.lexeme) << " : ";
-    genExpr(stmt->iterable.get());
-    out << ") ";
+    if (stmt->parallel) {
+        if (!rangeCall || stmt->isEntryLoop()) {
+            errorOut << "Compile Error: parallel for requires a single iterator over range(start, end, step)." << std::endl;
+            fail();
+        }
+        genParallelFor(stmt, rangeCall);
+        return;
+    }
+
+    DictionaryType* entryDict = nullptr;
+    if (stmt->isEntryLoop()) {
+        if (auto* var = dynamic_cast<VariableExpr*>(stmt->iterable.get())) {
+            VarInfo* info = resolveVar(var->name.lexeme);
+            if (info) entryDict = dynamic_cast<DictionaryType*>(info->type);
+        }
+    }
+
+    std::string iterName = sanitize(stmt->iterator.lexeme);
+    std::vector<std::string> iteratorDecls; // emitted at the top of the body when the loop variables are hidden
+    bool wrapped = false;
+
+    if (rangeCall) {
+        // Lower to a counted C loop so the optimizer sees a canonical induction variable.
+        // start/end/step are evaluated once, as RoxRange did.
+        std::string id = std::to_string(loopCounter++);
+        int64_t step = 0;
+        if (literalStep(rangeCall->arguments[2].get(), step)) {
+            // The iterator is a copy in ROX: if the body assigns it, iterate a hidden variable.
+            std::string var = mutatedVars.count(stmt->iterator.lexeme) ? "roxv26__i" + id : iterName;
+            if (var != iterName) iteratorDecls.push_back("int64_t " + iterName + " = " + var + ";");
+            emitIndent();
+            out << "for (int64_t " << var << " = ";
+            genExpr(rangeCall->arguments[0].get());
+            out << ", roxv26__end" << id << " = ";
+            genExpr(rangeCall->arguments[1].get());
+            out << "; " << var << (step > 0 ? " < " : " > ") << "roxv26__end" << id << "; " << var << " += ";
+            genExpr(rangeCall->arguments[2].get());
+            out << ") ";
+        } else {
+            // Unknown step sign: compute the trip count once (this also rejects step 0)
+            // and count up, so the loop test never depends on the sign.
+            runtimeUses.insert("range_count");
+            emitLine("{");
+            indentLevel++;
+            wrapped = true;
+            emitIndent();
+            out << "const int64_t roxv26__start" << id << " = ";
+            genExpr(rangeCall->arguments[0].get());
+            out << ";\n";
+            emitIndent();
+            out << "const int64_t roxv26__step" << id << " = ";
+            genExpr(rangeCall->arguments[2].get());
+            out << ";\n";
+            emitIndent();
+            out << "const int64_t roxv26__n" << id << " = rox_range_count(roxv26__start" << id << ", ";
+            genExpr(rangeCall->arguments[1].get());
+            out << ", roxv26__step" << id << ");\n";
+            emitIndent();
+            out << "for (int64_t roxv26__k" << id << " = 0; roxv26__k" << id << " < roxv26__n" << id
+                << "; ++roxv26__k" << id << ") ";
+            iteratorDecls.push_back("int64_t " + iterName + " = roxv26__start" + id + " + roxv26__k" + id + " * roxv26__step" + id + ";");
+        }
+    } else if (stmt->isEntryLoop()) {
+        // Walk the table directly: one slot visit per entry, no key copy and no lookup.
+        // Key and value bind by reference unless the body assigns them.
+        std::string valueName = sanitize(stmt->valueIterator.lexeme);
+        emitIndent();
+        if (mutatedVars.count(stmt->iterator.lexeme) || mutatedVars.count(stmt->valueIterator.lexeme)) {
+            std::string entry = "roxv26__e" + std::to_string(loopCounter++);
+            out << "for (const auto& " << entry << " : ";
+            iteratorDecls.push_back("auto " + iterName + " = " + entry + ".first;");
+            iteratorDecls.push_back("auto " + valueName + " = " + entry + ".second;");
+        } else {
+            out << "for (const auto& [" << iterName << ", " << valueName << "] : ";
+        }
+        genExpr(stmt->iterable.get());
+        out << ") ";
+    } else {
+        emitIndent();
+        out << "for (auto " << iterName << " : ";
+        genExpr(stmt->iterable.get());
+        out << ") ";
+    }
+
+    enterScope();
+
+    // Declare the iterator; range() iterators over [0, xs.size()) with a positive step
+    // are recorded as proven indices of xs.
+    if (rangeCall) {
+        ownedTypes.push_back(std::make_unique<PrimitiveType>(Token{TokenType::TYPE_INT64, "int64", stmt->iterator.line}));
+        declareVar(stmt->iterator.lexeme, ownedTypes.back().get());
+
+        auto* step = dynamic_cast<LiteralExpr*>(rangeCall->arguments[2].get());
+        size_t coll = provenSizeOf(rangeCall->arguments[1].get());
+        if (coll && step && step->value.type == TokenType::NUMBER_INT &&
+            isNonNegative(rangeCall->arguments[0].get()) && !mutatedVars.count(stmt->iterator.lexeme)) {
+            resolveVar(stmt->iterator.lexeme)->indexOf = coll;
+        }
+        resolveVar(stmt->iterator.lexeme)->isNonZero = rangeAvoidsZero(rangeCall);
+    }
+
+    if (stmt->isEntryLoop()) {
+        declareVar(stmt->iterator.lexeme, entryDict ? entryDict->keyType.get() : nullptr);
+        declareVar(stmt->valueIterator.lexeme, entryDict ? entryDict->valueType.get() : nullptr);
+    }
 
     // Track the iterated variable to detect mutations during iteration
     std::string iteratedName;
     if (auto* var = dynamic_cast<VariableExpr*>(stmt->iterable.get())) {
         iteratedName = var->name.lexeme;
         iteratedVars.insert(iteratedName);
+        VarInfo* info = resolveVar(iteratedName);
+        if (info && info->type) {
+            if (auto* lt = dynamic_cast<ListType*>(info->type)) {
+                declareVar(stmt->iterator.lexeme, lt->elementType.get());
+            }
+        }
     }
 
-    genStmt(stmt->body.get());
+    if (iteratorDecls.empty()) {
+        genStmt(stmt->body.get());
+    } else {
+        out << "{\n";
+        indentLevel++;
+        for (const auto& decl : iteratorDecls) emitLine(decl);
+        genStmt(stmt->body.get());
+        indentLevel--;
+        emitLine("}");
+    }
+
+    exitScope();
+
+    if (wrapped) {
+        indentLevel--;
+        emitLine("}");
+    }
 
     if (!iteratedName.empty()) {
         iteratedVars.erase(iteratedName);
     }
 }
 
+// --- Function values ---
+
+// The top-level function an expression names, as resolved by Sema (which honours shadowing).
+FunctionStmt* Codegen::knownFunction(Expr* expr) {
+    auto* var = dynamic_cast<VariableExpr*>(expr);
+    return var ? var->function : nullptr;
+}
+
+// --- Parallel loops ---
+
+// True if the named user function prints or reads input, directly or through calls.
+bool Codegen::performsIo(const std::string& name) {
+    static const std::unordered_set<std::string> ioBuiltins = {
+        "print", "read_line", "read_int64", "read_float64", "stdin_lines"};
+    if (ioBuiltins.count(name)) return true;
+    auto cached = ioFunctions.find(name);
+    if (cached != ioFunctions.end()) return cached->second;
+    ioFunctions[name] = false; // recursion: assume pure until proven otherwise
+    bool io = false;
+    for (const auto& stmt : statements) {
+        auto* fn = dynamic_cast<FunctionStmt*>(stmt.get());
+        if (!fn || fn->name.lexeme != name) continue;
+        walkStmt(fn, [](Stmt*) {}, [&](Expr* e) {
+            auto* call = dynamic_cast<CallExpr*>(e);
+            auto* callee = call ? dynamic_cast<VariableExpr*>(call->callee.get()) : nullptr;
+            if (callee && callee->name.lexeme != name && performsIo(callee->name.lexeme)) io = true;
+            if (callee && ioBuiltins.count(callee->name.lexeme)) io = true;
+        });
+    }
+    ioFunctions[name] = io;
+    return io;
+}
+
+static Expr* rootObject(Expr* expr) {
+    while (auto* f = dynamic_cast<FieldAccessExpr*>(expr)) expr = f->object.get();
+    return expr;
+}
+
+static const std::unordered_set<std::string> mutatingMethods = {"append", "pop", "set", "remove", "sort"};
+
+// Calls onWrite with every variable `s` assigns, assigns a field of, or mutates through a
+// method, unless a declaration in scope at the write shadows it. `scopes` holds the names
+// declared around `s`; declarations inside `s` are added and dropped as blocks close.
+static void forEachOuterWrite(Stmt* s, std::vector<std::unordered_set<std::string>>& scopes,
+                              const std::function<void(const std::string&)>& onWrite) {
+    if (!s) return;
+    auto onExpr = [&](Expr* e) {
+        Expr* target = nullptr;
+        std::string name;
+        if (auto* a = dynamic_cast<AssignmentExpr*>(e)) name = a->name.lexeme;
+        else if (auto* fa = dynamic_cast<FieldAssignExpr*>(e)) target = fa->object.get();
+        else if (auto* m = dynamic_cast<MethodCallExpr*>(e); m && mutatingMethods.count(m->name.lexeme)) target = m->object.get();
+        if (auto* var = dynamic_cast<VariableExpr*>(rootObject(target))) name = var->name.lexeme;
+        if (name.empty()) return;
+        for (const auto& scope : scopes) {
+            if (scope.count(name)) return;
+        }
+        onWrite(name);
+    };
+    if (auto* b = dynamic_cast<BlockStmt*>(s)) {
+        scopes.push_back({});
+        for (const auto& c : b->statements) forEachOuterWrite(c.get(), scopes, onWrite);
+        scopes.pop_back();
+    } else if (auto* i = dynamic_cast<IfStmt*>(s)) {
+        walkExpr(i->condition.get(), onExpr);
+        forEachOuterWrite(i->thenBranch.get(), scopes, onWrite);
+        forEachOuterWrite(i->elseBranch.get(), scopes, onWrite);
+    } else if (auto* f = dynamic_cast<ForStmt*>(s)) {
+        walkExpr(f->iterable.get(), onExpr);
+        scopes.push_back({f->iterator.lexeme});
+        if (f->isEntryLoop()) scopes.back().insert(f->valueIterator.lexeme);
+        forEachOuterWrite(f->body.get(), scopes, onWrite);
+        scopes.pop_back();
+    } else if (auto* let = dynamic_cast<LetStmt*>(s)) {
+        walkExpr(let->initializer.get(), onExpr);
+        scopes.back().insert(let->name.lexeme);
+    } else if (auto* r = dynamic_cast<ReturnStmt*>(s)) {
+        walkExpr(r->value.get(), onExpr);
+    } else if (auto* es = dynamic_cast<ExprStmt*>(s)) {
+        walkExpr(es->expression.get(), onExpr);
+    }
+}
+
+// True if the named user function writes a global, directly or through calls. Calls
+// through function-typed variables could reach anything, so they count as writes; so
+// does handing a writing function to a builtin such as spawn or parallel_map.
+bool Codegen::writesGlobals(const std::string& name) {
+    if (globalWriters.empty()) {
+        // Direct writes first, then spread to users until nothing changes (calls may recurse).
+        std::unordered_map<std::string, std::unordered_set<std::string>> uses;
+        for (const auto& stmt : statements) {
+            auto* fn = dynamic_cast<FunctionStmt*>(stmt.get());
+            if (!fn) continue;
+            bool writes = false;
+            // Rox has no closures, so a write to anything but a parameter or local is a global.
+            std::vector<std::unordered_set<std::string>> scopes(1);
+            for (const auto& p : fn->params) scopes[0].insert(p.name.lexeme);
+            for (const auto& c : fn->body) forEachOuterWrite(c.get(), scopes, [&](const std::string&) { writes = true; });
+            walkStmt(fn, [](Stmt*) {}, [&](Expr* e) {
+                if (auto* call = dynamic_cast<CallExpr*>(e); call && call->callee->type && !knownFunction(call->callee.get())) writes = true;
+                if (FunctionStmt* used = knownFunction(e)) uses[fn->name.lexeme].insert(used->name.lexeme);
+            });
+            globalWriters[fn->name.lexeme] = writes;
+        }
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (const auto& [fn, used] : uses) {
+                if (globalWriters[fn]) continue;
+                for (const auto& u : used) {
+                    if (globalWriters[u]) { globalWriters[fn] = changed = true; break; }
+                }
+            }
+        }
+    }
+    auto found = globalWriters.find(name);
+    return found != globalWriters.end() && found->second;
+}
+
+// Rejects anything in a parallel body whose effect would depend on scheduling:
+// writes to variables declared outside the loop (other than reductions), directly or
+// by calling functions that write globals, I/O, and leaving the loop early.
+void Codegen::checkParallelBody(ForStmt* stmt) {
+    std::unordered_set<std::string> reduced;
+    for (const auto& r : stmt->reductions) reduced.insert(r.name.lexeme);
+
+    auto fail = [this](const std::string& msg) {
+        errorOut << "Compile Error: parallel for: " << msg << std::endl;
+        Codegen::fail();
+    };
+    std::vector<std::unordered_set<std::string>> scopes = {{stmt->iterator.lexeme}};
+    forEachOuterWrite(stmt->body.get(), scopes, [&](const std::string& name) {
+        if (!reduced.count(name)) fail("cannot write outer variable '" + name + "'. Use a reduce(...) clause.");
+    });
+
+    std::function<void(Stmt*, int)> visit = [&](Stmt* s, int loopDepth) {
+        if (!s) return;
+        if (dynamic_cast<ReturnStmt*>(s)) fail("cannot return from the loop body.");
+        if (dynamic_cast<BreakStmt*>(s) && loopDepth == 0) fail("cannot break out of the loop.");
+        auto onExpr = [&](Expr* e) {
+            if (auto* c = dynamic_cast<CallExpr*>(e)) {
+                auto* callee = dynamic_cast<VariableExpr*>(c->callee.get());
+                if (callee && performsIo(callee->name.lexeme)) {
+                    fail("'" + callee->name.lexeme + "' prints or reads input, which has no defined order across threads.");
+                }
+                if (c->callee->type && !knownFunction(c->callee.get())) {
+                    fail("cannot call a function value, which might write outer variables.");
+                }
+            }
+            if (FunctionStmt* fn = knownFunction(e); fn && writesGlobals(fn->name.lexeme)) {
+                fail("'" + fn->name.lexeme + "' writes global variables.");
+            }
+        };
+        if (auto* b = dynamic_cast<BlockStmt*>(s)) {
+            for (const auto& c : b->statements) visit(c.get(), loopDepth);
+        } else if (auto* i = dynamic_cast<IfStmt*>(s)) {
+            walkExpr(i->condition.get(), onExpr);
+            visit(i->thenBranch.get(), loopDepth);
+            visit(i->elseBranch.get(), loopDepth);
+        } else if (auto* f = dynamic_cast<ForStmt*>(s)) {
+            walkExpr(f->iterable.get(), onExpr);
+            visit(f->body.get(), loopDepth + 1);
+        } else if (auto* let = dynamic_cast<LetStmt*>(s)) {
+            walkExpr(let->initializer.get(), onExpr);
+        } else if (auto* es = dynamic_cast<ExprStmt*>(s)) {
+            walkExpr(es->expression.get(), onExpr);
+        }
+    };
+    visit(stmt->body.get(), 0);
+}
+
+// Lowers `parallel for i in range(a, b, s) reduce(x: op) { ... }` onto the runtime pool.
+// The trip count is cut into chunks that depend only on its size; each chunk folds into
+// its own partial, and partials are combined in chunk order after the loop, so results
+// do not depend on the number of threads.
+void Codegen::genParallelFor(ForStmt* stmt, CallExpr* rangeCall) {
+    struct Reduce { std::string name, cppType, op, partials; };
+    std::vector<Reduce> reductions;
+    std::unordered_set<std::string> seen;
+    for (const auto& r : stmt->reductions) {
+        const std::string& name = r.name.lexeme;
+        if (!seen.insert(name).second) {
+            errorOut << "Compile Error: '" << name << "' appears twice in reduce clause." << std::endl;
+            fail();
+        }
+        VarInfo* info = resolveVar(name);
+        auto* pt = info ? dynamic_cast<PrimitiveType*>(info->type) : nullptr;
+        if (!pt || (pt->token.type != TokenType::TYPE_INT64 && pt->token.type != TokenType::TYPE_FLOAT64)) {
+            errorOut << "Compile Error: reduce variable '" << name << "' must be a declared int64 or float64." << std::endl;
+            fail();
+        }
+        const std::string& op = r.op.lexeme;
+        if (op != "+" && op != "*" && op != "min" && op != "max") {
+            errorOut << "Compile Error: Unknown reduction operator '" << op << "'. Use +, *, min or max." << std::endl;
+            fail();
+        }
+        reductions.push_back({name, pt->token.type == TokenType::TYPE_INT64 ? "int64_t" : "double", op, ""});
+    }
+    checkParallelBody(stmt);
+
+    std::string id = std::to_string(loopCounter++);
+    std::string start = "roxv26__start" + id, step = "roxv26__step" + id, n = "roxv26__n" + id;
+    runtimeUses.insert("range_count");
+    runtimeUses.insert("pool");
+
+    emitLine("{");
+    indentLevel++;
+    emitIndent();
+    out << "const int64_t " << start << " = ";
+    genExpr(rangeCall->arguments[0].get());
+    out << ";\n";
+    emitIndent();
+    out << "const int64_t " << step << " = ";
+    genExpr(rangeCall->arguments[2].get());
+    out << ";\n";
+    emitIndent();
+    out << "const int64_t " << n << " = rox_range_count(" << start << ", ";
+    genExpr(rangeCall->arguments[1].get());
+    out << ", " << step << ");\n";
+    for (auto& r : reductions) {
+        r.partials = "roxv26__part_" + r.name + id;
+        emitLine("std::vector<" + r.cppType + "> " + r.partials + "(rox_parallel_chunks(" + n + "));");
+    }
+    emitLine("rox_parallel_for(" + n + ", [&](int64_t roxv26__c" + id + ", int64_t roxv26__lo" + id +
+             ", int64_t roxv26__hi" + id + ") {");
+    indentLevel++;
+    // Each chunk shadows the reduction variables with the operator's identity.
+    for (const auto& r : reductions) {
+        std::string identity = r.op == "+" ? "0" : r.op == "*" ? "1"
+            : "rox_" + r.op + "_identity<" + r.cppType + ">()";
+        emitLine(r.cppType + " " + sanitize(r.name) + " = " + identity + ";");
+    }
+    emitLine("for (int64_t roxv26__k" + id + " = roxv26__lo" + id + "; roxv26__k" + id + " < roxv26__hi" + id +
+             "; ++roxv26__k" + id + ") {");
+    indentLevel++;
+    emitLine("int64_t " + sanitize(stmt->iterator.lexeme) + " = " + start + " + roxv26__k" + id + " * " + step + ";");
+
+    enterScope();
+    ownedTypes.push_back(std::make_unique<PrimitiveType>(Token{TokenType::TYPE_INT64, "int64", stmt->iterator.line}));
+    declareVar(stmt->iterator.lexeme, ownedTypes.back().get());
+    int64_t literal = 0;
+    size_t coll = provenSizeOf(rangeCall->arguments[1].get());
+    if (coll && literalStep(rangeCall->arguments[2].get(), literal) && literal > 0 &&
+        isNonNegative(rangeCall->arguments[0].get()) && !mutatedVars.count(stmt->iterator.lexeme)) {
+        resolveVar(stmt->iterator.lexeme)->indexOf = coll;
+    }
+    resolveVar(stmt->iterator.lexeme)->isNonZero = rangeAvoidsZero(rangeCall);
+    genStmt(stmt->body.get());
+    exitScope();
+
+    indentLevel--;
+    emitLine("}");
+    for (const auto& r : reductions) {
+        emitLine(r.partials + "[roxv26__c" + id + "] = " + sanitize(r.name) + ";");
+    }
+    indentLevel--;
+    emitLine("});");
+    for (const auto& r : reductions) {
+        std::string var = sanitize(r.name);
+        std::string combined = r.op == "+" ? var + " + roxv26__p" + id
+            : r.op == "*" ? var + " * roxv26__p" + id
+            : "std::" + r.op + "(" + var + ", roxv26__p" + id + ")";
+        emitLine("for (" + r.cppType + " roxv26__p" + id + " : " + r.partials + ") " + var + " = " + combined + ";");
+    }
+    indentLevel--;
+    emitLine("}");
+}
+
 void Codegen::genFunction(FunctionStmt* stmt) {
     std::string oldFunctionName = currentFunctionName;
     currentFunctionName = sanitize(stmt->name.lexeme);
+    mutatedVars = collectMutatedVars(stmt);
+    arenaLets = collectArenaLets(stmt);
+    smallLets = collectSmallLets(stmt, smallListReturns);
+    auto small = smallListReturns.find(stmt->name.lexeme);
+    returnSmallList = small == smallListReturns.end() ? 0 : small->second;
+    loopCounter = 0;
+    enterScope();
+    for (const auto& p : stmt->params) {
+        declareVar(p.name.lexeme, p.type.get());
+    }
 
     emitIndent();
     // Special case for main
@@ -582,8 +3049,7 @@ void Codegen::genFunction(FunctionStmt* stmt) {
         out << "int main(";
         out << ") {\n";
         indentLevel++;
-        emitIndent();
-        out << "std::cout << std::boolalpha;\n";
+        emitArenaFor(stmt->body);
         for (const auto& s : stmt->body) {
             genStmt(s.get());
         }
@@ -591,21 +3057,18 @@ void Codegen::genFunction(FunctionStmt* stmt) {
         out << "return 0;\n";
         indentLevel--;
         emitLine("}");
+        exitScope();
+        mutatedVars.clear();
+        arenaLets.clear();
+        smallLets.clear();
         currentFunctionName = oldFunctionName;
         return;
     }
 
-    // Return Type
-    genType(stmt->returnType.get());
-    out << " " << sanitize(stmt->name.lexeme) << "(";
-
-    for (size_t i = 0; i < stmt->params.size(); ++i) {
-        if (i > 0) out << ", ";
-        genType(stmt->params[i].type.get());
-        out << " " << sanitize(stmt->params[i].name.lexeme);
-    }
-    out << ") {\n";
+    genSignature(stmt);
+    out << " {\n";
     indentLevel++;
+    emitArenaFor(stmt->body);
     for (const auto& s : stmt->body) {
         genStmt(s.get());
     }
@@ -619,9 +3082,51 @@ void Codegen::genFunction(FunctionStmt* stmt) {
 
     indentLevel--;
     emitLine("}");
+    exitScope();
+    mutatedVars.clear();
+    arenaLets.clear();
+    smallLets.clear();
+    returnSmallList = 0;
     currentFunctionName = oldFunctionName;
 }
 
+// Template header, return type, name and parameters, as declared and as defined.
+void Codegen::genSignature(FunctionStmt* stmt) {
+    // Function-typed parameters are template parameters: a call that passes a known
+    // function instantiates a clone in which the callback is a direct call.
+    if (takesFunctions(stmt)) {
+        std::string sep;
+        out << "template<";
+        for (size_t i = 0; i < stmt->params.size(); ++i) {
+            if (!dynamic_cast<FunctionType*>(stmt->params[i].type.get())) continue;
+            out << sep << "typename roxv26__F" << i;
+            sep = ", ";
+        }
+        out << ">\n";
+        emitIndent();
+    }
+
+    // Return Type
+    auto small = smallListReturns.find(stmt->name.lexeme);
+    if (small != smallListReturns.end()) {
+        runtimeUses.insert("small_list");
+        out << "RoxSmallList<";
+        genType(dynamic_cast<ListType*>(stmt->returnType.get())->elementType.get());
+        out << ", " << small->second << ">";
+    } else {
+        genType(stmt->returnType.get());
+    }
+    out << " " << sanitize(stmt->name.lexeme) << "(";
+
+    for (size_t i = 0; i < stmt->params.size(); ++i) {
+        if (i > 0) out << ", ";
+        if (dynamic_cast<FunctionType*>(stmt->params[i].type.get())) out << "roxv26__F" << i;
+        else genType(stmt->params[i].type.get());
+        out << " " << sanitize(stmt->params[i].name.lexeme);
+    }
+    out << ")";
+}
+
 void Codegen::genReturn(ReturnStmt* stmt) {
     // If in main, we must return 0.
     // If there is a return value (like `return none;`), we evaluate it if needed, but discard result for C++ main.
@@ -651,7 +3156,16 @@ void Codegen::genReturn(ReturnStmt* stmt) {
              out << " 0";
         }
     } else {
-        if (stmt->value) {
+        auto* listLit = dynamic_cast<ListLiteralExpr*>(stmt->value.get());
+        if (returnSmallList && listLit) {
+            // Built in place in the RoxSmallList result
+            out << " {";
+            for (size_t i = 0; i < listLit->elements.size(); ++i) {
+                if (i > 0) out << ", ";
+                genExpr(listLit->elements[i].get());
+            }
+            out << "}";
+        } else if (stmt->value) {
             out << " ";
             genExpr(stmt->value.get());
         } else {
@@ -663,6 +3177,50 @@ void Codegen::genReturn(ReturnStmt* stmt) {
 
 void Codegen::genLet(LetStmt* stmt) {
     emitIndent();
+    if (arenaLets.count(stmt)) {
+        // Same container with a std::pmr allocator drawing from the block's arena.
+        if (stmt->isConst) out << "const ";
+        std::string name = sanitize(stmt->name.lexeme);
+        if (auto* lt = dynamic_cast<ListType*>(stmt->type.get())) {
+            out << "std::pmr::vector<";
+            genType(lt->elementType.get());
+            out << "> " << name << "(";
+            auto* listLit = dynamic_cast<ListLiteralExpr*>(stmt->initializer.get());
+            if (listLit && !listLit->elements.empty()) {
+                out << "{";
+                for (size_t i = 0; i < listLit->elements.size(); ++i) {
+                    if (i > 0) out << ", ";
+                    genExpr(listLit->elements[i].get());
+                }
+                out << "}, ";
+            }
+        } else if (auto* dt = dynamic_cast<DictionaryType*>(stmt->type.get())) {
+            runtimeUses.insert("dict");
+            out << "std::pmr::unordered_map<";
+            genType(dt->keyType.get());
+            out << ", ";
+            genType(dt->valueType.get());
+            out << "> " << name << "(";
+        }
+        out << "&roxv26__arena);\n";
+        declareVar(stmt->name.lexeme, stmt->type.get());
+        return;
+    }
+    if (smallLets.count(stmt)) {
+        // Keeps the callee's RoxSmallList as is: the list never leaves this block.
+        auto* call = dynamic_cast<CallExpr*>(stmt->initializer.get());
+        auto* callee = dynamic_cast<VariableExpr*>(call->callee.get());
+        if (stmt->isConst) out << "const ";
+        out << "RoxSmallList<";
+        genType(dynamic_cast<ListType*>(stmt->type.get())->elementType.get());
+        out << ", " << smallListReturns[callee->name.lexeme] << "> " << sanitize(stmt->name.lexeme) << " = ";
+        keepSmallList = true;
+        genExpr(call);
+        out << ";\n";
+        declareVar(stmt->name.lexeme, stmt->type.get());
+        return;
+    }
+    if (inlineDefinitions && currentFunctionName.empty()) out << "inline "; // a global in a shared header
     if (stmt->isConst) out << "const ";
     genType(stmt->type.get());
     out << " " << sanitize(stmt->name.lexeme);
@@ -670,13 +3228,7 @@ void Codegen::genLet(LetStmt* stmt) {
     declareVar(stmt->name.lexeme, stmt->type.get());
 
     if (!stmt->initializer) {
-        // Ban uninitialized records
-        if (dynamic_cast<RecordType*>(stmt->type.get())) {
-            std::cerr << "Compile Error: Uninitialized record. Use default("
-                      << stmt->type->toString() << ") or an explicit initializer." << std::endl;
-            exit(1);
-        }
-        // No initializer -> default initialization
+        // No initializer (never a record: Sema requires one) -> default initialization
         out << "{};";
         out << "\n";
         return;
@@ -688,9 +3240,14 @@ void Codegen::genLet(LetStmt* stmt) {
     // This fixes issues with empty lists [] where std::vector{} (CTAD) fails.
     if (auto* listLit = dynamic_cast<ListLiteralExpr*>(stmt->initializer.get())) {
         if (auto* listType = dynamic_cast<ListType*>(stmt->type.get())) {
-             out << "std::vector<";
-             genType(listType->elementType.get());
-             out << ">{";
+             if (dynamic_cast<SoaListType*>(listType)) {
+                 genType(listType);
+                 out << "{";
+             } else {
+                 out << "std::vector<";
+                 genType(listType->elementType.get());
+                 out << ">{";
+             }
              for (size_t i = 0; i < listLit->elements.size(); ++i) {
                  if (i > 0) out << ", ";
                  genExpr(listLit->elements[i].get());
@@ -703,6 +3260,25 @@ void Codegen::genLet(LetStmt* stmt) {
 
     genExpr(stmt->initializer.get());
     out << ";\n";
+
+    // A folded division or math builtin, or a division by a nonzero divisor, is ok by construction.
+    if (dynamic_cast<OkExpr*>(stmt->initializer.get()) || isProvenDivision(stmt->initializer.get())) {
+        VarInfo* info = resolveVar(stmt->name.lexeme);
+        info->isProvenOk = true;
+        info->isStaticOk = true;
+    }
+    if (isNonZero(stmt->initializer.get())) resolveVar(stmt->name.lexeme)->isNonZero = true;
+
+    // Range analysis bookkeeping for the freshly declared variable
+    if (auto* m = dynamic_cast<MethodCallExpr*>(stmt->initializer.get())) {
+        VarInfo* info = resolveVar(stmt->name.lexeme);
+        if (isProvenAccess(m)) {
+            info->isProvenOk = true;
+            info->isStaticOk = true;
+        } else if (!mutatedVars.count(stmt->name.lexeme)) {
+            info->sizeOf = provenSizeOf(m);
+        }
+    }
 }
 
 void Codegen::genExprStmt(ExprStmt* stmt) {
@@ -713,8 +3289,10 @@ void Codegen::genExprStmt(ExprStmt* stmt) {
 
 void Codegen::genBinary(BinaryExpr* expr) {
     std::string op = expr->op.lexeme;
+    bool unchecked = (op == "/" || op == "%") && isNonZero(expr->right.get());
+    if (op == "/" || op == "%") runtimeUses.insert("div");
     if (op == "/") {
-        out << "rox_div(";
+        out << (unchecked ? "rox_div_unchecked(" : "rox_div(");
         genExpr(expr->left.get());
         out << ", ";
         genExpr(expr->right.get());
@@ -722,7 +3300,7 @@ void Codegen::genBinary(BinaryExpr* expr) {
         return;
     }
     if (op == "%") {
-        out << "rox_mod(";
+        out << (unchecked ? "rox_mod_unchecked(" : "rox_mod(");
         genExpr(expr->left.get());
         out << ", ";
         genExpr(expr->right.get());
@@ -762,6 +3340,20 @@ void Codegen::genLiteral(LiteralExpr* expr) {
 }
 
 void Codegen::genVariable(VariableExpr* expr) {
+    if (const char* fragment = builtinFragment(expr->name.lexeme)) runtimeUses.insert(fragment);
+    // As a value, a function template is the instance that takes plain function pointers.
+    if (FunctionStmt* fn = knownFunction(expr); fn && takesFunctions(fn)) {
+        out << sanitize(expr->name.lexeme) << "<";
+        std::string sep;
+        for (const auto& p : fn->params) {
+            if (!dynamic_cast<FunctionType*>(p.type.get())) continue;
+            out << sep;
+            genType(p.type.get());
+            sep = ", ";
+        }
+        out << ">";
+        return;
+    }
     // Map ROX EOF to C++ EOF_CONST (avoids collision with C macro)
     if (expr->name.lexeme == "EOF") {
         out << "EOF_CONST";
@@ -778,18 +3370,43 @@ void Codegen::genAssignment(AssignmentExpr* expr) {
 }
 
 void Codegen::genCall(CallExpr* expr) {
+    bool keepSmall = keepSmallList;
+    keepSmallList = false;
+
     // Check for unsafe getValue(var)
     if (auto* var = dynamic_cast<VariableExpr*>(expr->callee.get())) {
         if (var->name.lexeme == "getValue" && expr->arguments.size() == 1) {
             if (auto* arg = dynamic_cast<VariableExpr*>(expr->arguments[0].get())) {
                 VarInfo* info = resolveVar(arg->name.lexeme);
                 if (info && !info->isProvenOk) {
-                    std::cerr << "Compile Error: getValue(" << arg->name.lexeme
+                    errorOut << "Compile Error: getValue(" << arg->name.lexeme
                               << ") is unsafe. Variable '" << arg->name.lexeme
                               << "' is not proven to be Ok in this scope. "
                               << "Wrap it in 'if (isOk(" << arg->name.lexeme << ")) { ... }'."
                               << std::endl;
-                    exit(1);
+                    fail();
+                }
+                // Statically ok results skip the runtime check entirely
+                if (info && info->isStaticOk) {
+                    out << sanitize(arg->name.lexeme) << ".value";
+                    return;
+                }
+            }
+            if (auto* bin = dynamic_cast<BinaryExpr*>(expr->arguments[0].get()); bin && isProvenDivision(bin)) {
+                out << "(";
+                genExpr(bin->left.get());
+                out << " " << bin->op.lexeme << " ";
+                genExpr(bin->right.get());
+                out << ")";
+                return;
+            }
+        }
+        if (var->name.lexeme == "isOk" && expr->arguments.size() == 1) {
+            if (auto* arg = dynamic_cast<VariableExpr*>(expr->arguments[0].get())) {
+                VarInfo* info = resolveVar(arg->name.lexeme);
+                if (info && info->isStaticOk) {
+                    out << "true";
+                    return;
                 }
             }
         }
@@ -798,6 +3415,7 @@ void Codegen::genCall(CallExpr* expr) {
     // Intercept range() calls to emit RoxRange constructor
     if (auto* callee = dynamic_cast<VariableExpr*>(expr->callee.get())) {
         if (callee->name.lexeme == "range") {
+            runtimeUses.insert("range");
             out << "RoxRange(";
             for (size_t i = 0; i < expr->arguments.size(); ++i) {
                 if (i > 0) out << ", ";
@@ -806,39 +3424,91 @@ void Codegen::genCall(CallExpr* expr) {
             out << ")";
             return;
         }
+        // Parallel list builtins and spawn run their function argument on pool threads.
+        static const std::unordered_set<std::string> parallelBuiltins = {
+            "parallel_map", "parallel_filter", "parallel_reduce", "spawn"};
+        if (parallelBuiltins.count(callee->name.lexeme) && !expr->arguments.empty()) {
+            Expr* fnExpr = callee->name.lexeme == "spawn" ? expr->arguments.front().get()
+                                                          : expr->arguments.back().get();
+            FunctionStmt* fn = knownFunction(fnExpr);
+            if (!fn) {
+                errorOut << "Compile Error: " << callee->name.lexeme << ": pass a function by name; a function value"
+                          << " might print or write globals from several threads." << std::endl;
+                fail();
+            }
+            if (performsIo(fn->name.lexeme)) {
+                errorOut << "Compile Error: " << callee->name.lexeme << ": '" << fn->name.lexeme
+                          << "' prints or reads input, which has no defined order across threads."
+                          << std::endl;
+                fail();
+            }
+            if (writesGlobals(fn->name.lexeme)) {
+                errorOut << "Compile Error: " << callee->name.lexeme << ": '" << fn->name.lexeme
+                          << "' writes global variables, which would race across threads." << std::endl;
+                fail();
+            }
+        }
         // Intercept read_line() — emit directly without namespacing
         if (callee->name.lexeme == "read_line") {
+            runtimeUses.insert("stdin");
             out << "read_line()";
             return;
         }
     }
 
-    genExpr(expr->callee.get());
+    // Known functions passed to a callback parameter go by type rather than by pointer.
+    static const std::unordered_map<std::string, size_t> builtinCallbacks = {
+        {"sort_by", 1}, {"parallel_map", 1}, {"parallel_filter", 1}, {"parallel_reduce", 2}, {"spawn", 0}};
+    FunctionStmt* calleeFn = knownFunction(expr->callee.get());
+    auto* calleeVar = dynamic_cast<VariableExpr*>(expr->callee.get());
+    auto callback = calleeVar ? builtinCallbacks.find(calleeVar->name.lexeme) : builtinCallbacks.end();
+    if (calleeFn) out << sanitize(calleeVar->name.lexeme); // the template deduces its callbacks
+    else genExpr(expr->callee.get());
     out << "(";
     for (size_t i = 0; i < expr->arguments.size(); ++i) {
         if (i > 0) out << ", ";
-        genExpr(expr->arguments[i].get());
+        Expr* arg = expr->arguments[i].get();
+        bool callbackParam = calleeFn ? i < calleeFn->params.size() && dynamic_cast<FunctionType*>(calleeFn->params[i].type.get())
+                                      : callback != builtinCallbacks.end() && callback->second == i;
+        if (callbackParam && knownFunction(arg)) {
+            runtimeUses.insert("function");
+            out << "RoxKnownFn<&";
+            genExpr(arg);
+            out << ">{}";
+        } else {
+            genExpr(arg);
+        }
     }
     out << ")";
+    if (calleeFn && smallListReturns.count(calleeVar->name.lexeme) && !keepSmall) out << ".vec()";
 }
 
 void Codegen::genMethodCall(MethodCallExpr* expr) {
     std::string method = expr->name.lexeme;
 
     // Compile-time guard: block mutations on collections being iterated
-    static const std::unordered_set<std::string> mutatingMethods = {"append", "pop"};
-    if (mutatingMethods.count(method)) {
+    // (dictionary set/remove can rehash the table under a `for k, v in d` loop).
+    static const std::unordered_set<std::string> mutatingMethods = {"append", "pop", "sort"};
+    static const std::unordered_set<std::string> dictMutatingMethods = {"set", "remove"};
+    if (mutatingMethods.count(method) || dictMutatingMethods.count(method)) {
         if (auto* var = dynamic_cast<VariableExpr*>(expr->object.get())) {
-            if (iteratedVars.count(var->name.lexeme)) {
-                std::cerr << "Compile Error: Cannot mutate '" << var->name.lexeme
+            VarInfo* info = resolveVar(var->name.lexeme);
+            bool isDict = info && dynamic_cast<DictionaryType*>(info->type);
+            if (iteratedVars.count(var->name.lexeme) && (mutatingMethods.count(method) || isDict)) {
+                errorOut << "Compile Error: Cannot mutate '" << var->name.lexeme
                           << "' while iterating over it." << std::endl;
-                exit(1);
+                fail();
             }
         }
     }
 
+    static const std::unordered_map<std::string, const char*> methodFragments = {
+        {"at", "access"}, {"set", "access"}, {"sort", "sort"},
+        {"get", "dict"}, {"remove", "dict"}, {"has", "dict"}, {"getKeys", "dict"}};
+    if (auto it = methodFragments.find(method); it != methodFragments.end()) runtimeUses.insert(it->second);
+
     if (method == "at") {
-        out << "rox_at(";
+        out << (isProvenAccess(expr) ? "rox_at_unchecked(" : "rox_at(");
         genExpr(expr->object.get());
         out << ", ";
         if (!expr->arguments.empty()) genExpr(expr->arguments[0].get());
@@ -853,10 +3523,10 @@ void Codegen::genMethodCall(MethodCallExpr* expr) {
        if (auto* var = dynamic_cast<VariableExpr*>(expr->object.get())) {
             VarInfo* info = resolveVar(var->name.lexeme);
             if (info && !info->isProvenOk) {
-                 std::cerr << "Compile Error: " << var->name.lexeme << ".getValue() is unsafe. "
+                 errorOut << "Compile Error: " << var->name.lexeme << ".getValue() is unsafe. "
                            << "Variable '" << var->name.lexeme << "' is not proven to be Ok in this scope."
                            << std::endl;
-                 exit(1);
+                 fail();
             }
        }
        out << "getValue(";
@@ -869,19 +3539,6 @@ void Codegen::genMethodCall(MethodCallExpr* expr) {
         if (!expr->arguments.empty()) genExpr(expr->arguments[0].get());
         out << ")";
     } else if (method == "append") {
-        auto objType = inferType(expr->object.get());
-        if (auto* listType = dynamic_cast<ListType*>(objType.get())) {
-             if (expr->arguments.empty()) {
-                 std::cerr << "Error: list.append expects 1 argument." << std::endl;
-                 exit(1);
-             }
-             auto argType = inferType(expr->arguments[0].get());
-             if (argType && argType->toString() != listType->elementType->toString()) {
-                  std::cerr << "Type Error: List append type mismatch. Expected " << listType->elementType->toString()
-                            << " but got " << argType->toString() << "." << std::endl;
-                  exit(1);
-             }
-        }
         genExpr(expr->object.get());
         out << ".push_back(";
         if (!expr->arguments.empty()) genExpr(expr->arguments[0].get());
@@ -889,29 +3546,12 @@ void Codegen::genMethodCall(MethodCallExpr* expr) {
     } else if (method == "pop") {
         genExpr(expr->object.get());
         out << ".pop_back()";
+    } else if (method == "sort") {
+        // In-place ascending sort. Records have no ordering (Sema sends them to sort_by).
+        out << "rox_sort(";
+        genExpr(expr->object.get());
+        out << ")";
     } else if (method == "set") {
-        // Semantic Analysis: Check for dictionary type mismatch
-        auto objType = inferType(expr->object.get());
-        if (auto* dictType = dynamic_cast<DictionaryType*>(objType.get())) {
-             if (expr->arguments.size() < 2) {
-                 std::cerr << "Error: dictionary.set expects 2 arguments." << std::endl;
-                 exit(1);
-             }
-             auto keyType = inferType(expr->arguments[0].get());
-             auto valType = inferType(expr->arguments[1].get());
-
-             if (keyType && keyType->toString() != dictType->keyType->toString()) {
-                  std::cerr << "Type Error: Dictionary key type mismatch. Expected " << dictType->keyType->toString()
-                            << " but got " << keyType->toString() << "." << std::endl;
-                  exit(1);
-             }
-             if (valType && valType->toString() != dictType->valueType->toString()) {
-                  std::cerr << "Type Error: Dictionary value type mismatch. Expected " << dictType->valueType->toString()
-                            << " but got " << valType->toString() << "." << std::endl;
-                  exit(1);
-             }
-        }
-
         out << "rox_set(";
         genExpr(expr->object.get());
         out << ", ";
@@ -991,31 +3631,95 @@ std::string Codegen::sanitize(const std::string& name) {
     return "roxv26_" + name;
 }
 
-std::unique_ptr<Type> Codegen::inferType(Expr* expr) {
-    if (!expr) return nullptr;
+// --- Record layout ---
+// Fields are stored by decreasing alignment so that records carry as little padding as
+// possible; initializers, SoA lists and the language itself keep declaration order.
+// Sizes mirror the emitted C++ types on this host's standard library.
 
-    if (auto* lit = dynamic_cast<LiteralExpr*>(expr)) {
-        if (lit->value.type == TokenType::NUMBER_INT) return std::make_unique<PrimitiveType>(Token{TokenType::TYPE_INT64, "int64", lit->value.line});
-        if (lit->value.type == TokenType::NUMBER_FLOAT) return std::make_unique<PrimitiveType>(Token{TokenType::TYPE_FLOAT64, "float64", lit->value.line});
-        if (lit->value.type == TokenType::STRING) return std::make_unique<PrimitiveType>(Token{TokenType::TYPE_STRING, "string", lit->value.line});
-        if (lit->value.type == TokenType::CHAR_LITERAL) return std::make_unique<PrimitiveType>(Token{TokenType::TYPE_CHAR, "char", lit->value.line});
-        if (lit->value.type == TokenType::TRUE || lit->value.type == TokenType::FALSE) return std::make_unique<PrimitiveType>(Token{TokenType::TYPE_BOOL, "bool", lit->value.line});
-        if (lit->value.type == TokenType::NONE) return std::make_unique<PrimitiveType>(Token{TokenType::NONE, "none", lit->value.line});
+Codegen::Layout Codegen::layoutOf(Type* type) {
+    if (auto* t = dynamic_cast<PrimitiveType*>(type)) {
+        switch (t->token.type) {
+            case TokenType::TYPE_INT64: return {8, 8};
+            case TokenType::TYPE_FLOAT64: return {8, 8};
+            case TokenType::TYPE_BOOL: return {1, 1};
+            case TokenType::TYPE_CHAR: return {1, 1};
+            case TokenType::TYPE_STRING: return {sizeof(std::string), alignof(std::string)};
+            case TokenType::TYPE_FILE_VIEW: return {sizeof(std::shared_ptr<char>) + 2 * sizeof(void*), alignof(void*)};
+            default: return {1, 1}; // none
+        }
     }
-
-    if (auto* var = dynamic_cast<VariableExpr*>(expr)) {
-        VarInfo* info = resolveVar(var->name.lexeme);
-        if (info && info->type) {
-             return info->type->clone();
+    if (auto* t = dynamic_cast<SoaListType*>(type)) {
+        size_t fields = 0;
+        if (auto* rt = dynamic_cast<RecordType*>(t->elementType.get())) {
+            auto it = typeRegistry.find(rt->name);
+            if (it != typeRegistry.end()) fields = it->second->fields.size();
         }
+        return {fields * sizeof(std::vector<int>) + sizeof(size_t), alignof(std::vector<int>)};
+    }
+    if (dynamic_cast<ListType*>(type)) return {sizeof(std::vector<int>), alignof(std::vector<int>)};
+    if (dynamic_cast<DictionaryType*>(type)) return {sizeof(std::unordered_map<int, int>), alignof(std::unordered_map<int, int>)};
+    if (dynamic_cast<TaskType*>(type)) return {sizeof(std::shared_ptr<int>), alignof(std::shared_ptr<int>)};
+    if (dynamic_cast<FunctionType*>(type)) return {sizeof(void (*)()), alignof(void (*)())};
+    if (auto* t = dynamic_cast<RoxResultType*>(type)) {
+        Layout value = layoutOf(t->valueType.get());
+        Layout err = {sizeof(std::string), alignof(std::string)};
+        size_t align = std::max(value.align, err.align);
+        size_t offset = (value.size + err.align - 1) / err.align * err.align + err.size;
+        return {(offset + align - 1) / align * align, align};
+    }
+    if (auto* t = dynamic_cast<RecordType*>(type)) {
+        auto it = typeRegistry.find(t->name);
+        if (it != typeRegistry.end()) return recordLayout(it->second, physicalOrder(it->second));
+    }
+    return {8, 8};
+}
+
+Codegen::Layout Codegen::recordLayout(TypeDefStmt* stmt, const std::vector<size_t>& order, size_t* padding) {
+    size_t offset = 0, align = 1, used = 0;
+    for (size_t i : order) {
+        Layout f = layoutOf(stmt->fields[i].type.get());
+        offset = (offset + f.align - 1) / f.align * f.align + f.size;
+        align = std::max(align, f.align);
+        used += f.size;
     }
+    size_t size = std::max<size_t>(1, (offset + align - 1) / align * align);
+    if (padding) *padding = size - used;
+    return {size, align};
+}
 
-    return nullptr;
+std::vector<size_t> Codegen::physicalOrder(TypeDefStmt* stmt) {
+    std::vector<size_t> order(stmt->fields.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::vector<size_t> aligns;
+    for (const auto& f : stmt->fields) aligns.push_back(layoutOf(f.type.get()).align);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return aligns[a] > aligns[b]; });
+    return order;
+}
+
+std::string Codegen::layoutReport() {
+    std::stringstream report;
+    for (const auto& stmt : statements) {
+        auto* td = dynamic_cast<TypeDefStmt*>(stmt.get());
+        if (!td) continue;
+        std::vector<size_t> declared(td->fields.size());
+        std::iota(declared.begin(), declared.end(), 0);
+        std::vector<size_t> physical = physicalOrder(td);
+        size_t padBefore = 0, padAfter = 0;
+        Layout before = recordLayout(td, declared, &padBefore);
+        Layout after = recordLayout(td, physical, &padAfter);
+        report << td->name.lexeme << ": " << before.size << " bytes (" << padBefore << " padding) -> "
+               << after.size << " bytes (" << padAfter << " padding)\n";
+        report << "  fields:";
+        for (size_t i : physical) report << " " << td->fields[i].name.lexeme;
+        report << "\n";
+    }
+    return report.str();
 }
 
 void Codegen::genTypeDef(TypeDefStmt* stmt) {
     out << "struct " << stmt->name.lexeme << " {\n";
-    for (const auto& field : stmt->fields) {
+    for (size_t i : physicalOrder(stmt)) {
+        const auto& field = stmt->fields[i];
         out << "  ";
         genType(field.type.get());
         out << " " << sanitize(field.name.lexeme) << ";\n";
@@ -1023,92 +3727,125 @@ void Codegen::genTypeDef(TypeDefStmt* stmt) {
     out << "};\n\n";
 }
 
+// soa_list[T] storage: one vector per field, read back as whole records.
+void Codegen::genSoaType(TypeDefStmt* stmt) {
+    std::string record = stmt->name.lexeme;
+    std::string soa = "RoxSoa_" + record;
+    out << "struct " << soa << " {\n";
+    out << "  using record_type = " << record << ";\n";
+    for (const auto& field : stmt->fields) {
+        out << "  std::vector<";
+        genType(field.type.get());
+        out << "> " << sanitize(field.name.lexeme) << ";\n";
+    }
+    out << "  size_t count = 0;\n";
+    out << "  " << soa << "() = default;\n";
+    out << "  " << soa << "(std::initializer_list<" << record << "> items) { for (const auto& r : items) push_back(r); }\n";
+    out << "  size_t size() const { return count; }\n";
+    out << "  void push_back(const " << record << "& r) {\n";
+    for (const auto& field : stmt->fields) {
+        std::string f = sanitize(field.name.lexeme);
+        out << "    " << f << ".push_back(r." << f << ");\n";
+    }
+    out << "    ++count;\n";
+    out << "  }\n";
+    out << "  void pop_back() {\n";
+    out << "    if (count == 0) return;\n";
+    for (const auto& field : stmt->fields) out << "    " << sanitize(field.name.lexeme) << ".pop_back();\n";
+    out << "    --count;\n";
+    out << "  }\n";
+    out << "  " << record << " operator[](size_t i) const { return " << record << "{";
+    bool first = true;
+    for (size_t f : physicalOrder(stmt)) {
+        if (!first) out << ", ";
+        first = false;
+        std::string name = sanitize(stmt->fields[f].name.lexeme);
+        out << "." << name << " = " << name << "[i]";
+    }
+    out << "}; }\n";
+    out << "  void assign(size_t i, const " << record << "& r) {\n";
+    for (const auto& field : stmt->fields) {
+        std::string f = sanitize(field.name.lexeme);
+        out << "    " << f << "[i] = r." << f << ";\n";
+    }
+    out << "  }\n";
+    out << "  struct iterator {\n";
+    out << "    const " << soa << "* list;\n";
+    out << "    size_t i;\n";
+    out << "    " << record << " operator*() const { return (*list)[i]; }\n";
+    out << "    iterator& operator++() { ++i; return *this; }\n";
+    out << "    bool operator!=(const iterator& other) const { return i != other.i; }\n";
+    out << "  };\n";
+    out << "  iterator begin() const { return {this, 0}; }\n";
+    out << "  iterator end() const { return {this, count}; }\n";
+    out << "};\n\n";
+}
+
 void Codegen::genRecordInit(RecordInitExpr* expr) {
+    // Sema has checked the fields against the type; only their order matters here.
     std::string typeName = expr->typeName.lexeme;
     auto it = typeRegistry.find(typeName);
-    if (it == typeRegistry.end()) {
-        std::cerr << "Compile Error: Unknown type '" << typeName << "'." << std::endl;
-        exit(1);
-    }
     TypeDefStmt* typeDef = it->second;
 
-    // Check for duplicate fields
-    std::unordered_set<std::string> seenFields;
-    for (const auto& fi : expr->fields) {
-        if (!seenFields.insert(fi.name.lexeme).second) {
-            std::cerr << "Compile Error: Duplicate field '" << fi.name.lexeme
-                      << "' in " << typeName << " initializer." << std::endl;
-            exit(1);
+    // Emit: TypeName{.field1 = val1, .field2 = val2}, designators in the struct's physical order
+    std::vector<size_t> order; // initializer index for each physical field
+    for (size_t f : physicalOrder(typeDef)) {
+        for (size_t i = 0; i < expr->fields.size(); ++i) {
+            if (expr->fields[i].name.lexeme == typeDef->fields[f].name.lexeme) order.push_back(i);
         }
     }
-
-    // Check for unknown fields
-    std::unordered_map<std::string, Type*> fieldTypes;
-    for (const auto& f : typeDef->fields) {
-        fieldTypes[f.name.lexeme] = f.type.get();
-    }
+    // Values with calls keep their source evaluation order via temporaries.
+    bool reordered = !std::is_sorted(order.begin(), order.end());
+    bool sideEffects = false;
     for (const auto& fi : expr->fields) {
-        if (fieldTypes.find(fi.name.lexeme) == fieldTypes.end()) {
-            std::cerr << "Compile Error: Unknown field '" << fi.name.lexeme
-                      << "' in type '" << typeName << "'." << std::endl;
-            exit(1);
-        }
-    }
-
-    // Check for missing fields
-    for (const auto& f : typeDef->fields) {
-        if (seenFields.find(f.name.lexeme) == seenFields.end()) {
-            std::cerr << "Compile Error: Missing field '" << f.name.lexeme
-                      << "' in " << typeName << " initializer." << std::endl;
-            exit(1);
-        }
+        walkExpr(fi.value.get(), [&](Expr* e) {
+            if (dynamic_cast<CallExpr*>(e) || dynamic_cast<MethodCallExpr*>(e) || dynamic_cast<AssignmentExpr*>(e)) sideEffects = true;
+        });
     }
-
-    // Check for type mismatches
-    for (const auto& fi : expr->fields) {
-        auto argType = inferType(fi.value.get());
-        Type* expectedType = fieldTypes[fi.name.lexeme];
-        if (argType && expectedType) {
-            if (argType->toString() != expectedType->toString()) {
-                std::cerr << "Type Error: Field '" << fi.name.lexeme << "' expects "
-                          << expectedType->toString() << " but got " << argType->toString()
-                          << "." << std::endl;
-                exit(1);
+    if (reordered && sideEffects) {
+        // Nothing to capture at namespace scope, where a global's initializer runs.
+        std::string id = std::to_string(loopCounter++);
+        out << (currentFunctionName.empty() ? "[]() { " : "[&]() { ");
+        for (size_t i = 0; i < expr->fields.size(); ++i) {
+            Type* fieldType = nullptr;
+            for (const auto& field : typeDef->fields) {
+                if (field.name.lexeme == expr->fields[i].name.lexeme) fieldType = field.type.get();
+            }
+            genType(fieldType);
+            out << " roxv26__f" << id << "_" << i;
+            // Brace-initialize list literals: std::vector{} cannot deduce an empty list's type.
+            auto* listLit = dynamic_cast<ListLiteralExpr*>(expr->fields[i].value.get());
+            if (listLit && dynamic_cast<ListType*>(fieldType)) {
+                out << "{";
+                for (size_t e = 0; e < listLit->elements.size(); ++e) {
+                    if (e > 0) out << ", ";
+                    genExpr(listLit->elements[e].get());
+                }
+                out << "}";
+            } else {
+                out << " = ";
+                genExpr(expr->fields[i].value.get());
             }
+            out << "; ";
+        }
+        out << "return " << typeName << "{";
+        for (size_t k = 0; k < order.size(); ++k) {
+            if (k > 0) out << ", ";
+            out << "." << sanitize(expr->fields[order[k]].name.lexeme) << " = std::move(roxv26__f" << id << "_" << order[k] << ")";
         }
+        out << "}; }()";
+        return;
     }
-
-    // Emit: TypeName{.field1 = val1, .field2 = val2}
     out << typeName << "{";
-    for (size_t i = 0; i < expr->fields.size(); ++i) {
-        if (i > 0) out << ", ";
-        out << "." << sanitize(expr->fields[i].name.lexeme) << " = ";
-        genExpr(expr->fields[i].value.get());
+    for (size_t k = 0; k < order.size(); ++k) {
+        if (k > 0) out << ", ";
+        out << "." << sanitize(expr->fields[order[k]].name.lexeme) << " = ";
+        genExpr(expr->fields[order[k]].value.get());
     }
     out << "}";
 }
 
 void Codegen::genFieldAccess(FieldAccessExpr* expr) {
-    // Validate field exists if we can determine the type
-    if (auto* var = dynamic_cast<VariableExpr*>(expr->object.get())) {
-        VarInfo* info = resolveVar(var->name.lexeme);
-        if (info && info->type) {
-            if (auto* rt = dynamic_cast<RecordType*>(info->type)) {
-                auto it = typeRegistry.find(rt->name);
-                if (it != typeRegistry.end()) {
-                    bool found = false;
-                    for (const auto& f : it->second->fields) {
-                        if (f.name.lexeme == expr->fieldName.lexeme) { found = true; break; }
-                    }
-                    if (!found) {
-                        std::cerr << "Compile Error: Unknown field '" << expr->fieldName.lexeme
-                                  << "' on type '" << rt->name << "'." << std::endl;
-                        exit(1);
-                    }
-                }
-            }
-        }
-    }
     genExpr(expr->object.get());
     out << "." << sanitize(expr->fieldName.lexeme);
 }
@@ -1119,6 +3856,12 @@ void Codegen::genFieldAssign(FieldAssignExpr* expr) {
     genExpr(expr->value.get());
 }
 
+void Codegen::genOk(OkExpr* expr) {
+    out << "ok(";
+    genExpr(expr->value.get());
+    out << ")";
+}
+
 void Codegen::genDefault(DefaultExpr* expr) {
     Type* t = expr->type.get();
     if (auto* pt = dynamic_cast<PrimitiveType*>(t)) {
@@ -1127,15 +3870,26 @@ void Codegen::genDefault(DefaultExpr* expr) {
         if (pt->token.type == TokenType::TYPE_BOOL) { out << "false"; return; }
         if (pt->token.type == TokenType::TYPE_CHAR) { out << "'\\0'"; return; }
         if (pt->token.type == TokenType::TYPE_STRING) { out << "rox_str(\"\")"; return; }
+        if (pt->token.type == TokenType::TYPE_FILE_VIEW) {
+            runtimeUses.insert("file_view");
+            out << "RoxFileView{}";
+            return;
+        }
         if (pt->token.type == TokenType::NONE) { out << "none"; return; }
     }
     if (auto* lt = dynamic_cast<ListType*>(t)) {
+        if (dynamic_cast<SoaListType*>(lt)) {
+            genType(lt);
+            out << "{}";
+            return;
+        }
         out << "std::vector<";
         genType(lt->elementType.get());
         out << ">{}";
         return;
     }
     if (auto* dt = dynamic_cast<DictionaryType*>(t)) {
+        runtimeUses.insert("dict");
         out << "std::unordered_map<";
         genType(dt->keyType.get());
         out << ", ";
@@ -1144,11 +3898,6 @@ void Codegen::genDefault(DefaultExpr* expr) {
         return;
     }
     if (auto* rt = dynamic_cast<RecordType*>(t)) {
-        auto it = typeRegistry.find(rt->name);
-        if (it == typeRegistry.end()) {
-            std::cerr << "Compile Error: Unknown type '" << rt->name << "'." << std::endl;
-            exit(1);
-        }
         out << rt->name << "{}";
         return;
     }
@@ -13,24 +13,93 @@ namespace rox {
 
 class Codegen {
 public:
-    Codegen(const std::vector<std::unique_ptr<Stmt>>& statements);
+    // `jobs` threads generate function bodies; the output is the same for any count.
+    Codegen(const std::vector<std::unique_ptr<Stmt>>& statements, unsigned jobs = 1);
+    explicit Codegen(const Codegen* parent); // worker for generateFunctions()
     std::string generate();
+    // A program split for separate compilation: `header` holds the runtime, records,
+    // prototypes, globals and function templates; each unit includes it and defines
+    // some of the other functions.
+    struct SplitProgram {
+        std::string header;
+        std::vector<std::string> units;
+    };
+    // At most `count` units, which include the header as `headerName`.
+    SplitProgram generateSplit(size_t count, const std::string& headerName);
+    // One translation unit per function (templates excepted), for incremental builds.
+    // Each unit includes the runtime as `runtimeName` (see runtimeHeader()) and carries
+    // only what its function refers to: the records, prototypes of the functions it
+    // calls, the globals and any function templates it instantiates. Editing a function
+    // leaves every unit that does not depend on its signature byte-for-byte unchanged.
+    struct FunctionUnit {
+        std::string name; // of the function
+        std::string source;
+    };
+    std::vector<FunctionUnit> generateFunctionUnits(const std::string& runtimeName);
+    // Every runtime fragment as one header, the same for any program, so that it can be
+    // precompiled once and shared by all units.
+    std::string runtimeHeader();
+    // Runs the checks codegen makes on the way (getValue safety, mutation while iterating,
+    // parallel loop bodies, ...) without producing C++. Returns the first error, if any,
+    // instead of exiting; call it instead of generate(), on a program Sema accepted.
+    std::vector<Diagnostic> check();
+    // Size and padding of every record before and after field reordering (valid after generate()).
+    std::string layoutReport();
+    // Bytes of runtime in front of the program (valid after generate(), generateSplit() or
+    // runtimeHeader()).
+    size_t preambleBytes() const { return preambleSize; }
 
 private:
     const std::vector<std::unique_ptr<Stmt>>& statements;
+    unsigned jobs = 1;
+    bool isWorker = false;
+    bool checking = false; // see check()
+    bool inlineDefinitions = false; // output is a header shared by several units: runtime and globals are emitted inline
     std::stringstream out;
+    std::ostringstream errorOut; // the compile error being reported, see fail()
+    int line = 0; // of the statement being generated, for check()
+    struct Abort {}; // thrown by fail() in a worker, or while checking
     int indentLevel = 0;
+    int loopCounter = 0; // suffix for compiler-generated loop temporaries
     std::string currentFunctionName = "";
 
     struct VarInfo {
         Type* type;
         bool isProvenOk;
+        bool isStaticOk = false; // result built by an access that cannot fail
+        size_t id = 0;           // this declaration (see declareVar)
+        size_t indexOf = 0;      // id of the collection this int64 is proven to index
+        size_t sizeOf = 0;       // id of the collection whose size() this int64 holds
+        bool isNonZero = false;  // number proven != 0 (only tracked for names never assigned)
     };
 
     using Scope = std::unordered_map<std::string, VarInfo>;
     std::vector<Scope> scopes;
+    size_t lastVarId = 0; // declarations get increasing ids; a worker continues after its parent's globals
     std::unordered_set<std::string> iteratedVars; // collections currently being iterated
     std::unordered_map<std::string, TypeDefStmt*> typeRegistry; // user-defined types
+    std::unordered_set<std::string> mutatedVars; // names assigned or mutated anywhere in the current function
+    std::vector<std::unique_ptr<Type>> ownedTypes; // types synthesized by codegen (e.g. range iterators)
+    std::unordered_map<std::string, bool> ioFunctions; // memo for performsIo
+    std::unordered_map<std::string, bool> globalWriters; // per function, filled on the first writesGlobals call
+    std::unordered_set<LetStmt*> arenaLets; // non-escaping collections of the current function
+    std::unordered_map<std::string, size_t> smallListReturns; // functions returning RoxSmallList -> inline capacity
+    std::unordered_set<LetStmt*> smallLets; // non-escaping locals that keep a RoxSmallList result
+    size_t returnSmallList = 0; // inline capacity of the current function's RoxSmallList result, if any
+    bool keepSmallList = false; // the call being emitted may stay a RoxSmallList
+    std::unordered_set<std::string> soaRecords; // record types used as soa_list elements
+    std::unordered_set<std::string> runtimeUses; // runtime fragments referenced so far (see emitPreamble)
+    size_t preambleSize = 0; // of the last emitPreamble()
+
+    struct Chunk {
+        FunctionStmt* fn; // null for a global
+        std::string code;
+    };
+    std::string typeDeclarations; // records and soa_list companions (see genDeclarations)
+    std::unordered_map<FunctionStmt*, std::string> prototypes; // every function but main
+    void genDeclarations();
+    std::vector<Chunk> generateFunctions();
+    [[noreturn]] void fail();
 
     void enterScope();
     void exitScope();
@@ -38,6 +107,17 @@ private:
     VarInfo* resolveVar(const std::string& name);
     void refineVar(const std::string& name);
     void invalidateVar(const std::string& name);
+    bool isLocalVar(const std::string& name);
+    size_t provenSizeOf(Expr* expr);
+    bool isNonNegative(Expr* expr);
+    bool isProvenAccess(MethodCallExpr* expr);
+    bool isNonZero(Expr* expr);
+    bool isProvenDivision(Expr* expr);
+    void proveNonZero(const std::vector<std::string>& names);
+    FunctionStmt* knownFunction(Expr* expr);
+    bool performsIo(const std::string& name);
+    bool writesGlobals(const std::string& name);
+    void checkParallelBody(ForStmt* stmt);
 
     void emitIndent();
     void emit(const std::string& s);
@@ -48,13 +128,15 @@ private:
     void genStmt(Stmt* stmt);
     void genExpr(Expr* expr);
     void genType(Type* type);
-    std::unique_ptr<Type> inferType(Expr* expr);
 
     // Helpers for dispatch
     void genBlock(BlockStmt* stmt);
+    void emitArenaFor(const std::vector<std::unique_ptr<Stmt>>& statements);
     void genIf(IfStmt* stmt);
     void genFor(ForStmt* stmt);
+    void genParallelFor(ForStmt* stmt, CallExpr* rangeCall);
     void genFunction(FunctionStmt* stmt);
+    void genSignature(FunctionStmt* stmt);
     void genReturn(ReturnStmt* stmt);
     void genBreak(BreakStmt* stmt);
     void genContinue(ContinueStmt* stmt);
@@ -70,11 +152,17 @@ private:
     void genCall(CallExpr* expr);
     void genMethodCall(MethodCallExpr* expr);
     void genListLiteral(ListLiteralExpr* expr);
+    struct Layout { size_t size; size_t align; };
+    Layout layoutOf(Type* type);
+    Layout recordLayout(TypeDefStmt* stmt, const std::vector<size_t>& order, size_t* padding = nullptr);
+    std::vector<size_t> physicalOrder(TypeDefStmt* stmt);
     void genTypeDef(TypeDefStmt* stmt);
+    void genSoaType(TypeDefStmt* stmt);
     void genRecordInit(RecordInitExpr* expr);
     void genFieldAccess(FieldAccessExpr* expr);
     void genFieldAssign(FieldAssignExpr* expr);
     void genDefault(DefaultExpr* expr);
+    void genOk(OkExpr* expr);
 };
 
 } // namespace rox
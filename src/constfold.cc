@@ -0,0 +1,306 @@
+#include "constfold.h"
+#include "lexer.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace rox {
+
+ConstFolder::ConstFolder(std::vector<std::unique_ptr<Stmt>>& statements) : statements(statements) {}
+
+void ConstFolder::fold() {
+    // Built-in constants, with the same literals the runtime defines.
+    scopes.push_back({{"pi", Value(3.141592653589793)}, {"e", Value(2.718281828459045)}});
+    scopes.push_back({}); // globals
+    // Declarations are visited in source order: a global const is only known to the
+    // functions that follow it, as in the generated C++.
+    for (const auto& stmt : statements) foldStmt(stmt.get());
+    scopes.clear();
+}
+
+auto ConstFolder::lookup(const std::string& name) -> std::optional<Value> {
+    for (auto it = scopes.rbegin(); it != scopes.rend(); ++it) {
+        auto found = it->find(name);
+        if (found != it->end()) return found->second;
+    }
+    return std::nullopt;
+}
+
+// True if a user declaration hides the builtin of this name.
+bool ConstFolder::isShadowed(const std::string& name) {
+    for (size_t i = scopes.size(); i-- > 1;) {
+        if (scopes[i].count(name)) return true;
+    }
+    return false;
+}
+
+// Literal value of an int64, float64 or bool literal, or of a negated number literal.
+auto ConstFolder::valueOf(Expr* expr) -> std::optional<Value> {
+    bool negate = false;
+    if (auto* unary = dynamic_cast<UnaryExpr*>(expr)) {
+        if (unary->op.type != TokenType::MINUS) return std::nullopt;
+        negate = true;
+        expr = unary->right.get();
+    }
+    auto* lit = dynamic_cast<LiteralExpr*>(expr);
+    if (!lit) return std::nullopt;
+    try {
+        if (lit->value.type == TokenType::NUMBER_INT) {
+            int64_t v = std::stoll(lit->value.lexeme);
+            return Value(negate ? -v : v);
+        }
+        if (lit->value.type == TokenType::NUMBER_FLOAT) {
+            double v = std::stod(lit->value.lexeme);
+            return Value(negate ? -v : v);
+        }
+    } catch (const std::out_of_range&) {
+        return std::nullopt;
+    }
+    if (negate) return std::nullopt;
+    if (lit->value.type == TokenType::TRUE) return Value(true);
+    if (lit->value.type == TokenType::FALSE) return Value(false);
+    return std::nullopt;
+}
+
+// Number literals stay non-negative (range analysis relies on it): negative values
+// become a unary minus applied to a literal.
+std::unique_ptr<Expr> ConstFolder::literalOf(const Value& value, int line) {
+    if (auto* b = std::get_if<bool>(&value)) {
+        return std::make_unique<LiteralExpr>(Token{*b ? TokenType::TRUE : TokenType::FALSE, *b ? "true" : "false", line});
+    }
+    bool negative = false;
+    Token token{TokenType::NUMBER_INT, "", line};
+    if (auto* i = std::get_if<int64_t>(&value)) {
+        negative = *i < 0;
+        token.lexeme = std::to_string(negative ? -(uint64_t)*i : (uint64_t)*i);
+    } else {
+        double d = std::get<double>(value);
+        negative = std::signbit(d);
+        char buf[64];
+        auto res = std::to_chars(buf, buf + sizeof buf, std::fabs(d)); // shortest round-trip form
+        token.type = TokenType::NUMBER_FLOAT;
+        token.lexeme = std::string(buf, res.ptr);
+        if (token.lexeme.find_first_of(".e") == std::string::npos) token.lexeme += ".0";
+    }
+    std::unique_ptr<Expr> lit = std::make_unique<LiteralExpr>(token);
+    if (!negative) return lit;
+    return std::make_unique<UnaryExpr>(Token{TokenType::MINUS, "-", line}, std::move(lit));
+}
+
+void ConstFolder::foldStmt(Stmt* stmt) {
+    if (!stmt) return;
+    if (auto* s = dynamic_cast<BlockStmt*>(stmt)) {
+        scopes.push_back({});
+        for (const auto& c : s->statements) foldStmt(c.get());
+        scopes.pop_back();
+    } else if (auto* s = dynamic_cast<IfStmt*>(stmt)) {
+        foldExpr(s->condition);
+        foldStmt(s->thenBranch.get());
+        foldStmt(s->elseBranch.get());
+    } else if (auto* s = dynamic_cast<ForStmt*>(stmt)) {
+        foldExpr(s->iterable);
+        scopes.push_back({{s->iterator.lexeme, std::nullopt}});
+        if (s->isEntryLoop()) scopes.back()[s->valueIterator.lexeme] = std::nullopt;
+        foldStmt(s->body.get());
+        scopes.pop_back();
+    } else if (auto* s = dynamic_cast<FunctionStmt*>(stmt)) {
+        scopes.back()[s->name.lexeme] = std::nullopt;
+        scopes.push_back({});
+        for (const auto& p : s->params) scopes.back()[p.name.lexeme] = std::nullopt;
+        for (const auto& c : s->body) foldStmt(c.get());
+        scopes.pop_back();
+    } else if (auto* s = dynamic_cast<ReturnStmt*>(stmt)) {
+        if (s->value) foldExpr(s->value);
+    } else if (auto* s = dynamic_cast<LetStmt*>(stmt)) {
+        if (s->initializer) foldExpr(s->initializer);
+        // Only a const whose folded initializer is a literal of its declared type propagates.
+        std::optional<Value> value;
+        auto* pt = dynamic_cast<PrimitiveType*>(s->type.get());
+        if (s->isConst && pt && s->initializer) {
+            value = valueOf(s->initializer.get());
+            bool matches = value && ((pt->token.type == TokenType::TYPE_INT64 && std::holds_alternative<int64_t>(*value)) ||
+                                     (pt->token.type == TokenType::TYPE_FLOAT64 && std::holds_alternative<double>(*value)) ||
+                                     (pt->token.type == TokenType::TYPE_BOOL && std::holds_alternative<bool>(*value)));
+            if (!matches) value.reset();
+        }
+        scopes.back()[s->name.lexeme] = value;
+    } else if (auto* s = dynamic_cast<ExprStmt*>(stmt)) {
+        foldExpr(s->expression);
+    }
+}
+
+void ConstFolder::foldExpr(std::unique_ptr<Expr>& expr) {
+    if (!expr) return;
+    if (auto* e = dynamic_cast<VariableExpr*>(expr.get())) {
+        if (auto value = lookup(e->name.lexeme)) expr = literalOf(*value, e->name.line);
+    } else if (auto* e = dynamic_cast<UnaryExpr*>(expr.get())) {
+        foldExpr(e->right);
+        if (dynamic_cast<LiteralExpr*>(e->right.get())) {
+            if (e->op.type != TokenType::NOT) return; // already a negative literal
+            if (auto value = valueOf(e->right.get())) {
+                if (auto* b = std::get_if<bool>(&*value)) expr = literalOf(!*b, e->op.line);
+            }
+            return;
+        }
+        auto value = valueOf(e->right.get());
+        if (e->op.type != TokenType::MINUS || !value) return;
+        if (auto* i = std::get_if<int64_t>(&*value)) {
+            if (*i != std::numeric_limits<int64_t>::min()) expr = literalOf(-*i, e->op.line);
+        } else if (auto* d = std::get_if<double>(&*value)) {
+            expr = literalOf(-*d, e->op.line);
+        }
+    } else if (auto* e = dynamic_cast<BinaryExpr*>(expr.get())) {
+        foldExpr(e->left);
+        foldExpr(e->right);
+        if (auto folded = foldBinary(e)) expr = std::move(folded);
+    } else if (auto* e = dynamic_cast<LogicalExpr*>(expr.get())) {
+        foldExpr(e->left);
+        foldExpr(e->right);
+        auto l = valueOf(e->left.get()), r = valueOf(e->right.get());
+        auto* lb = l ? std::get_if<bool>(&*l) : nullptr;
+        auto* rb = r ? std::get_if<bool>(&*r) : nullptr;
+        if (lb && rb) expr = literalOf(e->op.type == TokenType::AND ? (*lb && *rb) : (*lb || *rb), e->op.line);
+    } else if (auto* e = dynamic_cast<CallExpr*>(expr.get())) {
+        for (auto& a : e->arguments) foldExpr(a);
+        if (auto folded = foldCall(e)) expr = std::move(folded);
+    } else if (auto* e = dynamic_cast<MethodCallExpr*>(expr.get())) {
+        foldExpr(e->object);
+        for (auto& a : e->arguments) foldExpr(a);
+    } else if (auto* e = dynamic_cast<AssignmentExpr*>(expr.get())) {
+        foldExpr(e->value);
+    } else if (auto* e = dynamic_cast<ListLiteralExpr*>(expr.get())) {
+        for (auto& el : e->elements) foldExpr(el);
+    } else if (auto* e = dynamic_cast<RecordInitExpr*>(expr.get())) {
+        for (auto& f : e->fields) foldExpr(f.value);
+    } else if (auto* e = dynamic_cast<FieldAccessExpr*>(expr.get())) {
+        foldExpr(e->object);
+    } else if (auto* e = dynamic_cast<FieldAssignExpr*>(expr.get())) {
+        foldExpr(e->object);
+        foldExpr(e->value);
+    }
+}
+
+// Folds arithmetic and comparisons on two literals of the same type. Anything that
+// would overflow, divide by zero or leave the finite doubles is left to run time.
+std::unique_ptr<Expr> ConstFolder::foldBinary(BinaryExpr* expr) {
+    auto l = valueOf(expr->left.get()), r = valueOf(expr->right.get());
+    if (!l || !r || l->index() != r->index()) return nullptr;
+    int line = expr->op.line;
+    TokenType op = expr->op.type;
+
+    switch (op) {
+        case TokenType::EQUAL_EQUAL: return literalOf(*l == *r, line);
+        case TokenType::LESS: if (std::holds_alternative<bool>(*l)) return nullptr; return literalOf(*l < *r, line);
+        case TokenType::LESS_EQUAL: if (std::holds_alternative<bool>(*l)) return nullptr; return literalOf(*l <= *r, line);
+        case TokenType::GREATER: if (std::holds_alternative<bool>(*l)) return nullptr; return literalOf(*l > *r, line);
+        case TokenType::GREATER_EQUAL: if (std::holds_alternative<bool>(*l)) return nullptr; return literalOf(*l >= *r, line);
+        default: break;
+    }
+
+    if (auto* a = std::get_if<int64_t>(&*l)) {
+        int64_t b = std::get<int64_t>(*r);
+        int64_t v = 0;
+        switch (op) {
+            case TokenType::PLUS: if (__builtin_add_overflow(*a, b, &v)) return nullptr; return literalOf(v, line);
+            case TokenType::MINUS: if (__builtin_sub_overflow(*a, b, &v)) return nullptr; return literalOf(v, line);
+            case TokenType::STAR: if (__builtin_mul_overflow(*a, b, &v)) return nullptr; return literalOf(v, line);
+            case TokenType::SLASH:
+            case TokenType::PERCENT:
+                if (b == 0 || (b == -1 && *a == std::numeric_limits<int64_t>::min())) return nullptr;
+                return std::make_unique<OkExpr>(literalOf(op == TokenType::SLASH ? *a / b : *a % b, line));
+            default: return nullptr;
+        }
+    }
+    if (auto* a = std::get_if<double>(&*l)) {
+        double b = std::get<double>(*r);
+        double v = 0;
+        switch (op) {
+            case TokenType::PLUS: v = *a + b; break;
+            case TokenType::MINUS: v = *a - b; break;
+            case TokenType::STAR: v = *a * b; break;
+            case TokenType::SLASH: v = *a / b; break;
+            default: return nullptr;
+        }
+        if (!std::isfinite(v) || (op == TokenType::SLASH && b == 0)) return nullptr;
+        if (op == TokenType::SLASH) return std::make_unique<OkExpr>(literalOf(v, line));
+        return literalOf(v, line);
+    }
+    return nullptr;
+}
+
+// Math builtins with literal arguments; getValue / isOk of an already-ok result.
+std::unique_ptr<Expr> ConstFolder::foldCall(CallExpr* expr) {
+    auto* callee = dynamic_cast<VariableExpr*>(expr->callee.get());
+    if (!callee || isShadowed(callee->name.lexeme)) return nullptr;
+    const std::string& name = callee->name.lexeme;
+    int line = expr->paren.line;
+
+    if ((name == "getValue" || name == "isOk") && expr->arguments.size() == 1) {
+        auto* ok = dynamic_cast<OkExpr*>(expr->arguments[0].get());
+        if (!ok) return nullptr;
+        if (name == "isOk") return literalOf(true, line);
+        return std::move(ok->value);
+    }
+
+    std::vector<Value> args;
+    for (const auto& a : expr->arguments) {
+        auto v = valueOf(a.get());
+        if (!v) return nullptr;
+        args.push_back(*v);
+    }
+    auto ints = [&](size_t n) {
+        if (args.size() != n) return false;
+        for (const auto& a : args) if (!std::holds_alternative<int64_t>(a)) return false;
+        return true;
+    };
+    auto floats = [&](size_t n) {
+        if (args.size() != n) return false;
+        for (const auto& a : args) if (!std::holds_alternative<double>(a)) return false;
+        return true;
+    };
+    auto i = [&](size_t k) { return std::get<int64_t>(args[k]); };
+    auto f = [&](size_t k) { return std::get<double>(args[k]); };
+    auto real = [&](double v) -> std::unique_ptr<Expr> { return std::isfinite(v) ? literalOf(v, line) : nullptr; };
+
+    if (ints(1) && name == "int64_abs") {
+        if (i(0) == std::numeric_limits<int64_t>::min()) return nullptr;
+        return literalOf(i(0) < 0 ? -i(0) : i(0), line);
+    }
+    if (ints(2) && name == "int64_min") return literalOf(std::min(i(0), i(1)), line);
+    if (ints(2) && name == "int64_max") return literalOf(std::max(i(0), i(1)), line);
+    if (ints(2) && name == "int64_pow") {
+        int64_t base = i(0), exp = i(1), v = 1;
+        if (exp < 0) return nullptr; // the runtime reports the error
+        if (base == 0 || base == 1 || base == -1) {
+            v = exp == 0 ? 1 : base == -1 && exp % 2 == 0 ? 1 : base;
+        } else {
+            for (int64_t k = 0; k < exp; ++k) { // |base| >= 2 overflows within 63 steps
+                if (__builtin_mul_overflow(v, base, &v)) return nullptr;
+            }
+        }
+        return std::make_unique<OkExpr>(literalOf(v, line));
+    }
+    if (floats(1)) {
+        double x = f(0);
+        if (name == "float64_abs") return real(std::fabs(x));
+        if (name == "float64_sin") return real(std::sin(x));
+        if (name == "float64_cos") return real(std::cos(x));
+        if (name == "float64_tan") return real(std::tan(x));
+        if (name == "float64_exp") return real(std::exp(x));
+        if (name == "float64_floor") return real(std::floor(x));
+        if (name == "float64_ceil") return real(std::ceil(x));
+        if (name == "float64_sqrt" && x >= 0) return std::make_unique<OkExpr>(literalOf(std::sqrt(x), line));
+        if (name == "float64_log" && x > 0) return std::make_unique<OkExpr>(literalOf(std::log(x), line));
+    }
+    if (floats(2)) {
+        if (name == "float64_min") return real(std::min(f(0), f(1)));
+        if (name == "float64_max") return real(std::max(f(0), f(1)));
+        if (name == "float64_pow") return real(std::pow(f(0), f(1)));
+    }
+    return nullptr;
+}
+
+} // namespace rox
@@ -0,0 +1,44 @@
+#ifndef ROX_CONSTFOLD_H
+#define ROX_CONSTFOLD_H
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <optional>
+#include <variant>
+#include <unordered_map>
+#include "ast.h"
+
+namespace rox {
+
+// Folds literal and `const` expressions in place before codegen: arithmetic,
+// comparisons, logic and the int64_* / float64_* math builtins. Division, modulo
+// and the fallible builtins fold to an OkExpr, so they are still results.
+class ConstFolder {
+public:
+    ConstFolder(std::vector<std::unique_ptr<Stmt>>& statements);
+    void fold();
+
+private:
+    using Value = std::variant<int64_t, double, bool>;
+    // nullopt: the name is declared here but is not a compile-time constant
+    using Scope = std::unordered_map<std::string, std::optional<Value>>;
+
+    std::vector<std::unique_ptr<Stmt>>& statements;
+    std::vector<Scope> scopes;
+
+    std::optional<Value> lookup(const std::string& name);
+    bool isShadowed(const std::string& name);
+
+    void foldStmt(Stmt* stmt);
+    void foldExpr(std::unique_ptr<Expr>& expr);
+    std::unique_ptr<Expr> foldBinary(BinaryExpr* expr);
+    std::unique_ptr<Expr> foldCall(CallExpr* expr);
+
+    static std::optional<Value> valueOf(Expr* expr);
+    static std::unique_ptr<Expr> literalOf(const Value& value, int line);
+};
+
+} // namespace rox
+
+#endif // ROX_CONSTFOLD_H
@@ -1,6 +1,5 @@
 #include "lexer.h"
 #include <unordered_map>
-#include <iostream>
 
 namespace rox {
 
@@ -24,14 +23,18 @@ const std::unordered_map<std::string, TokenType>& Lexer::getKeywords() {
         {"continue", TokenType::CONTINUE},
         {"type", TokenType::TYPE},
         {"default", TokenType::DEFAULT},
+        {"parallel", TokenType::PARALLEL},
         {"int64", TokenType::TYPE_INT64},
         {"float64", TokenType::TYPE_FLOAT64},
         {"bool", TokenType::TYPE_BOOL},
         {"char", TokenType::TYPE_CHAR},
         {"list", TokenType::TYPE_LIST},
+        {"soa_list", TokenType::TYPE_SOA_LIST},
         {"dictionary", TokenType::TYPE_DICT},
         {"string", TokenType::TYPE_STRING},
         {"rox_result", TokenType::TYPE_ROX_RESULT},
+        {"file_view", TokenType::TYPE_FILE_VIEW},
+        {"task", TokenType::TYPE_TASK},
     };
     return keywords;
 }
@@ -47,6 +50,18 @@ const std::unordered_set<std::string>& Lexer::getBuiltins() {
         // Math Functions (float64)
         "float64_abs", "float64_min", "float64_max", "float64_pow", "float64_sqrt",
         "float64_sin", "float64_cos", "float64_tan", "float64_log", "float64_exp", "float64_floor", "float64_ceil",
+        // List Reductions
+        "int64_sum", "int64_list_min", "int64_list_max", "float64_sum", "float64_sum_kahan", "float64_dot", "count_equal",
+        // Sorting
+        "sort_by",
+        // Input
+        "read_int64", "read_float64", "stdin_lines",
+        // Files
+        "read_file", "map_file",
+        // Parallel list operations
+        "parallel_map", "parallel_filter", "parallel_reduce",
+        // Tasks
+        "spawn", "join",
         // Collection Helpers
         "rox_at", "rox_set", "rox_remove", "rox_has", "rox_keys", "rox_div", "rox_mod", "rox_get",
         // Special
@@ -123,7 +138,7 @@ void Lexer::scanToken() {
             } else if (isalpha(c)) {
                 identifier();
             } else {
-                std::cerr << "Unexpected character at line " << line << ": " << c << std::endl;
+                errors.push_back({line, std::string("Unexpected character: ") + c});
             }
             break;
     }
@@ -135,8 +150,7 @@ void Lexer::identifier() {
     std::string text = source.substr(start, current - start);
 
     if (text.rfind("roxv26_", 0) == 0) { // Check if starts with "roxv26_"
-        std::cerr << "Error: Identifier '" << text << "' cannot start with reserved prefix 'roxv26_'." << std::endl;
-        exit(1);
+        errors.push_back({line, "Error: Identifier '" + text + "' cannot start with reserved prefix 'roxv26_'."});
     }
 
     TokenType type = TokenType::IDENTIFIER;
@@ -176,7 +190,7 @@ void Lexer::string() {
     }
 
     if (isAtEnd()) {
-        std::cerr << "Unterminated string at line " << line << std::endl;
+        errors.push_back({line, "Unterminated string."});
         return;
     }
 
@@ -200,7 +214,7 @@ void Lexer::character() {
         advance();
         addToken(TokenType::CHAR_LITERAL);
     } else {
-         std::cerr << "Unterminated char literal at line " << line << std::endl;
+        errors.push_back({line, "Unterminated char literal."});
     }
 }
 
@@ -13,12 +13,15 @@ class Lexer {
 public:
     Lexer(const std::string& source);
     std::vector<Token> scanTokens();
+    // Errors found by scanTokens(); scanning goes on past them.
+    const std::vector<Diagnostic>& diagnostics() const { return errors; }
     static const std::unordered_map<std::string, TokenType>& getKeywords();
     static const std::unordered_set<std::string>& getBuiltins();
 
 private:
     std::string source;
     std::vector<Token> tokens;
+    std::vector<Diagnostic> errors;
     size_t start = 0;
     size_t current = 0;
     int line = 1;
@@ -3,10 +3,20 @@
 #include <sstream>
 #include <vector>
 #include <cstdlib>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <unordered_set>
 #include "lexer.h"
 #include "parser.h"
+#include "constfold.h"
+#include "sema.h"
 #include "codegen.h"
 #include "formatter.h"
+#include "timing.h"
 
 std::string readFile(const std::string& path) {
     std::ifstream file(path);
@@ -28,29 +38,98 @@ void writeFile(const std::string& path, const std::string& content) {
     file << content;
 }
 
-std::string generate_cc(const std::string& source) {
-    rox::Lexer lexer(source);
-    std::vector<rox::Token> allTokens = lexer.scanTokens();
+bool layoutReport = false; // --layout-report: print record sizes and padding
+unsigned jobs = std::thread::hardware_concurrency(); // --jobs N: codegen threads and clang processes
+unsigned units = 1; // --units N: translation units for `compile` and `run`
+
+bool incremental = false; // --incremental: keep per-function objects and rebuild only what changed
+std::string timePasses; // --time-passes: "text", or "json" for --time-passes=json
+rox::PassTimes passTimes; // reported at exit with --time-passes
 
-    // Filter comments for parser
+// A type-checked program. Sema owns the type annotations that codegen reads.
+struct Program {
+    std::vector<std::unique_ptr<rox::Stmt>> statements;
+    std::unique_ptr<rox::Sema> sema;
+};
+
+// Lexes, parses, folds and type-checks `source` into `program`. Returns the errors of the
+// first phase that finds any; the program is complete only if there are none.
+std::vector<rox::Diagnostic> analyze(const std::string& source, Program& program) {
     std::vector<rox::Token> parserTokens;
-    for (const auto& t : allTokens) {
-        if (t.type != rox::TokenType::COMMENT) {
-            parserTokens.push_back(t);
+    {
+        auto pass = passTimes.time("lex");
+        rox::Lexer lexer(source);
+        std::vector<rox::Token> allTokens = lexer.scanTokens();
+        if (!lexer.diagnostics().empty()) return lexer.diagnostics();
+        passTimes.count("tokens", allTokens.size());
+
+        // Filter comments for parser
+        for (const auto& t : allTokens) {
+            if (t.type != rox::TokenType::COMMENT) {
+                parserTokens.push_back(t);
+            }
+        }
+    }
+
+    {
+        auto pass = passTimes.time("parse");
+        rox::Parser parser(parserTokens);
+        program.statements = parser.parse();
+        if (!parser.diagnostics().empty()) return parser.diagnostics();
+    }
+    if (!timePasses.empty()) {
+        uint64_t nodes = 0;
+        for (const auto& stmt : program.statements) {
+            rox::walkStmt(stmt.get(), [&](rox::Stmt*) { ++nodes; }, [&](rox::Expr*) { ++nodes; });
         }
+        passTimes.count("ast_nodes", nodes);
     }
 
-    rox::Parser parser(parserTokens);
-    std::vector<std::unique_ptr<rox::Stmt>> statements = parser.parse();
+    {
+        auto pass = passTimes.time("fold");
+        rox::ConstFolder(program.statements).fold();
+    }
+
+    auto pass = passTimes.time("sema");
+    program.sema = std::make_unique<rox::Sema>(program.statements);
+    if (!program.sema->check()) return program.sema->diagnostics();
+    return {};
+}
+
+// analyze(), reporting every error and exiting if there is one.
+void check_program(const std::string& source, Program& program) {
+    std::vector<rox::Diagnostic> errors = analyze(source, program);
+    for (const auto& d : errors) {
+        std::cerr << "[line " << d.line << "] " << d.message << std::endl;
+    }
+    if (!errors.empty()) exit(1);
+}
+
+// The program's C++: one source file, or with --units a header and several units.
+rox::Codegen::SplitProgram generate_cc(const std::string& source, const std::string& name) {
+    Program program;
+    check_program(source, program);
 
-    rox::Codegen codegen(statements);
-    std::string result = codegen.generate();
+    rox::Codegen codegen(program.statements, jobs);
+    rox::Codegen::SplitProgram result;
+    {
+        auto pass = passTimes.time("codegen");
+        if (units > 1) result = codegen.generateSplit(units, name + ".h");
+        else result.units.push_back(codegen.generate());
+    }
+    passTimes.count("preamble_bytes", codegen.preambleBytes());
+    if (layoutReport) std::cout << codegen.layoutReport();
     return result;
 }
 
-void cmd_generate(const std::string& inputPath) {
-    std::string source = readFile(inputPath);
-    std::string cc = generate_cc(source);
+// Writes generated/<name>.cc, or with --units generated/<name>.h and <name>.0.cc,
+// <name>.1.cc, ...; returns the number of units written (0 for a single file).
+size_t cmd_generate(const std::string& inputPath) {
+    std::string source;
+    {
+        auto pass = passTimes.time("read");
+        source = readFile(inputPath);
+    }
 
     // Extract filename from input path (handle directories)
     std::string filename = inputPath;
@@ -67,14 +146,139 @@ void cmd_generate(const std::string& inputPath) {
     // Ensure generated directory exists
     system("mkdir -p generated");
 
-    std::string outputPath = "generated/" + filename + ".cc";
-    writeFile(outputPath, cc);
-    std::cout << "Generated " << outputPath << std::endl;
+    rox::Codegen::SplitProgram program = generate_cc(source, filename);
+    passTimes.count("cxx_bytes", program.header.size());
+    for (const auto& unit : program.units) passTimes.count("cxx_bytes", unit.size());
+    auto pass = passTimes.time("write");
+    if (program.header.empty()) {
+        std::string outputPath = "generated/" + filename + ".cc";
+        writeFile(outputPath, program.units[0]);
+        std::cout << "Generated " << outputPath << std::endl;
+        return 0;
+    }
+    writeFile("generated/" + filename + ".h", program.header);
+    for (size_t i = 0; i < program.units.size(); ++i) {
+        writeFile("generated/" + filename + "." + std::to_string(i) + ".cc", program.units[i]);
+    }
+    std::cout << "Generated generated/" << filename << ".h and " << program.units.size() << " units" << std::endl;
+    return program.units.size();
 }
 
-void cmd_compile(const std::string& inputPath) {
-    cmd_generate(inputPath);
+// Runs the commands on up to `jobs` threads; true if all of them succeed.
+bool runAll(const std::vector<std::string>& commands) {
+    std::atomic<size_t> next{0};
+    std::atomic<bool> ok{true};
+    auto work = [&]() {
+        for (size_t i = next++; i < commands.size(); i = next++) {
+            if (system(commands[i].c_str()) != 0) ok = false;
+        }
+    };
+    std::vector<std::thread> pool;
+    size_t threads = std::max<size_t>(1, std::min<size_t>(jobs, commands.size()));
+    for (size_t t = 1; t < threads; ++t) pool.emplace_back(work);
+    work();
+    for (auto& t : pool) t.join();
+    return ok;
+}
+
+// 64-bit FNV-1a of `text`, in hex.
+std::string hashText(const std::string& text) {
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : text) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    std::ostringstream hex;
+    hex << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return hex.str();
+}
+
+// --incremental: every function is its own translation unit, and its object is kept in
+// generated/<name>.cache/ under a hash of the unit's source and the compile command.
+// The unit already holds everything the function's C++ depends on (its body, the
+// signatures of the functions it calls, records, globals), so an unchanged hash means
+// the cached object is still correct. Only new hashes reach clang; the link is skipped
+// when no object changed. Objects no longer in the program are deleted.
+//
+// The runtime, which would otherwise dominate each unit's compile time, is the same
+// header for every unit and program: it is precompiled once per version of rox as
+// generated/runtime-<hash>.h.gch.
+bool compile_incremental(const std::string& inputPath, const std::string& name, const std::string& binaryPath) {
+    std::string source;
+    {
+        auto pass = passTimes.time("read");
+        source = readFile(inputPath);
+    }
+    Program program;
+    check_program(source, program);
+    rox::Codegen codegen(program.statements, jobs);
+
+    namespace fs = std::filesystem;
+    const std::string flags = "-w -std=c++20 -pthread";
+    std::string runtime;
+    {
+        auto pass = passTimes.time("codegen");
+        runtime = codegen.runtimeHeader();
+    }
+    passTimes.count("preamble_bytes", codegen.preambleBytes());
+    std::string runtimeName = "runtime-" + hashText(flags + "\n" + runtime) + ".h";
+    std::string runtimePath = "generated/" + runtimeName;
+    if (!fs::exists(runtimePath + ".gch")) {
+        writeFile(runtimePath, runtime);
+        auto pass = passTimes.time("compile");
+        std::string precompile = "clang++ " + flags + " -x c++-header -o " + runtimePath + ".tmp.gch " + runtimePath +
+                                 " && mv " + runtimePath + ".tmp.gch " + runtimePath + ".gch";
+        if (system(precompile.c_str()) != 0) return false;
+    }
+
+    std::vector<rox::Codegen::FunctionUnit> functionUnits;
+    {
+        auto pass = passTimes.time("codegen");
+        functionUnits = codegen.generateFunctionUnits("../" + runtimeName);
+    }
+    if (layoutReport) std::cout << codegen.layoutReport();
+
+    auto write = std::make_unique<rox::PassTimes::Scope>(passTimes, "write");
+    std::string cache = "generated/" + name + ".cache";
+    fs::create_directories(cache);
+    const std::string compile = "clang++ " + flags + " -include " + runtimePath + " -c";
+    std::vector<std::string> commands;
+    std::unordered_set<std::string> current;
+    std::string objects;
+    for (const auto& unit : functionUnits) {
+        passTimes.count("cxx_bytes", unit.source.size());
+        std::string base = cache + "/" + unit.name + "-" + hashText(compile + "\n" + unit.source);
+        current.insert(base + ".cc");
+        current.insert(base + ".o");
+        objects += " " + base + ".o";
+        if (fs::exists(base + ".o")) continue;
+        writeFile(base + ".cc", unit.source);
+        // Written under a temporary name, so an interrupted compile leaves no object behind
+        commands.push_back(compile + " -o " + base + ".tmp.o " + base + ".cc && mv " + base + ".tmp.o " + base + ".o");
+    }
+    std::string linkPath = cache + "/link"; // the objects of the last link
+    for (const auto& entry : fs::directory_iterator(cache)) {
+        if (!current.count(entry.path().string()) && entry.path().string() != linkPath) fs::remove(entry.path());
+    }
 
+    write.reset();
+
+    std::cout << "Recompiling " << commands.size() << " of " << functionUnits.size() << " functions" << std::endl;
+    {
+        auto pass = passTimes.time("compile");
+        if (!runAll(commands)) return false;
+    }
+    if (commands.empty() && fs::exists(binaryPath) && fs::exists(linkPath) && readFile(linkPath) == objects) {
+        return true;
+    }
+    auto pass = passTimes.time("link");
+    fs::remove(linkPath);
+    if (system(("clang++ -pthread -o " + binaryPath + objects).c_str()) != 0) return false;
+    writeFile(linkPath, objects);
+    return true;
+}
+
+void cmd_compile(const std::string& inputPath) {
     // Reconstruct output path logic to parse the filename
     std::string filename = inputPath;
     size_t lastSlash = inputPath.find_last_of('/');
@@ -88,9 +292,37 @@ void cmd_compile(const std::string& inputPath) {
     std::string ccPath = "generated/" + filename + ".cc";
     std::string binaryPath = "generated/" + filename;
 
-    std::string cmd = "clang++ -w -std=c++20 -o " + binaryPath + " " + ccPath;
-    int ret = system(cmd.c_str());
-    if (ret != 0) {
+    bool compiled;
+    if (incremental) {
+        compiled = compile_incremental(inputPath, filename, binaryPath);
+    } else if (size_t unitCount = cmd_generate(inputPath); unitCount == 0 && timePasses.empty()) {
+        std::string cmd = "clang++ -w -std=c++20 -pthread -o " + binaryPath + " " + ccPath;
+        compiled = system(cmd.c_str()) == 0;
+    } else if (unitCount == 0) {
+        // Compiled and linked apart, to time them apart
+        {
+            auto pass = passTimes.time("compile");
+            compiled = system(("clang++ -w -std=c++20 -pthread -c -o " + binaryPath + ".o " + ccPath).c_str()) == 0;
+        }
+        auto pass = passTimes.time("link");
+        compiled = compiled && system(("clang++ -pthread -o " + binaryPath + " " + binaryPath + ".o").c_str()) == 0;
+    } else {
+        // Units compile concurrently, then link
+        std::vector<std::string> commands;
+        std::string objects;
+        for (size_t i = 0; i < unitCount; ++i) {
+            std::string unit = "generated/" + filename + "." + std::to_string(i);
+            commands.push_back("clang++ -w -std=c++20 -pthread -c -o " + unit + ".o " + unit + ".cc");
+            objects += " " + unit + ".o";
+        }
+        {
+            auto pass = passTimes.time("compile");
+            compiled = runAll(commands);
+        }
+        auto pass = passTimes.time("link");
+        compiled = compiled && system(("clang++ -pthread -o " + binaryPath + objects).c_str()) == 0;
+    }
+    if (!compiled) {
         std::cerr << "Compilation failed." << std::endl;
         exit(1);
     }
@@ -111,12 +343,41 @@ void cmd_run(const std::string& inputPath) {
 
     std::string binaryPath = "generated/" + filename;
     std::string cmd = "./" + binaryPath;
+    auto pass = passTimes.time("run");
     int ret = system(cmd.c_str());
     if (ret != 0) {
         // Just return, let system handle exit code propogation if we care
     }
 }
 
+// Lexes, parses and runs every check, Sema's and codegen's, on each file without writing
+// or compiling C++. Errors go to stdout as `file:line: message` (line 0 if unknown), one
+// per line, for editors and scripts; returns true if every file is valid.
+bool cmd_check(const std::vector<std::string>& paths) {
+    bool valid = true;
+    for (const auto& path : paths) {
+        std::vector<rox::Diagnostic> errors;
+        std::stringstream buffer;
+        {
+            auto pass = passTimes.time("read");
+            std::ifstream file(path);
+            if (!file.is_open()) errors.push_back({0, "Could not open file"});
+            buffer << file.rdbuf();
+        }
+        if (errors.empty()) {
+            Program program;
+            errors = analyze(buffer.str(), program);
+            auto pass = passTimes.time("codegen");
+            if (errors.empty()) errors = rox::Codegen(program.statements, jobs).check();
+        }
+        for (const auto& d : errors) {
+            std::cout << path << ":" << d.line << ": " << d.message << "\n";
+        }
+        valid = valid && errors.empty();
+    }
+    return valid;
+}
+
 void cmd_format(const std::string& inputPath) {
     std::string source = readFile(inputPath);
     rox::Lexer lexer(source);
@@ -129,18 +390,44 @@ void cmd_format(const std::string& inputPath) {
     std::cout << "Formatted " << inputPath << std::endl;
 }
 
+// Prints the commands and options; returns the exit status for a bad invocation.
+int usage() {
+    std::cout << "Usage: rox <command> [args]" << std::endl;
+    std::cout << "Commands:" << std::endl;
+    std::cout << "  generate <file.rox>" << std::endl;
+    std::cout << "  compile <file.rox>" << std::endl;
+    std::cout << "  run <file.rox>" << std::endl;
+    std::cout << "  format <file.rox>" << std::endl;
+    std::cout << "  check <file.rox>...   report errors without generating C++" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << "  --layout-report   print each record's size and padding before and after field reordering" << std::endl;
+    std::cout << "  --jobs N          generate functions on N threads and run up to N clang processes (default: one per core)" << std::endl;
+    std::cout << "  --units N         compile: split the program into N translation units compiled in parallel" << std::endl;
+    std::cout << "  --incremental     compile: keep one object per function and recompile only the changed ones" << std::endl;
+    std::cout << "  --time-passes     print wall and CPU time per phase and counters to stderr (--time-passes=json for JSON)" << std::endl;
+    return 1;
+}
+
 int main(int argc, char* argv[]) {
-    if (argc < 2) {
-        std::cout << "Usage: rox <command> [args]" << std::endl;
-        std::cout << "Commands:" << std::endl;
-        std::cout << "  generate <file.rox>" << std::endl;
-        std::cout << "  compile <file.rox>" << std::endl;
-        std::cout << "  run <file.rox>" << std::endl;
-        std::cout << "  format <file.rox>" << std::endl;
-        return 1;
+    if (argc < 2) return usage();
+
+    // Options may appear anywhere after the command.
+    std::vector<char*> args;
+    for (int i = 0; i < argc; ++i) {
+        if (std::string(argv[i]) == "--layout-report") layoutReport = true;
+        else if (std::string(argv[i]) == "--jobs" && i + 1 < argc) jobs = (unsigned)std::atoi(argv[++i]);
+        else if (std::string(argv[i]) == "--units" && i + 1 < argc) units = (unsigned)std::atoi(argv[++i]);
+        else if (std::string(argv[i]) == "--incremental") incremental = true;
+        else if (std::string(argv[i]) == "--time-passes") timePasses = "text";
+        else if (std::string(argv[i]) == "--time-passes=json") timePasses = "json";
+        else args.push_back(argv[i]);
     }
+    argc = (int)args.size();
+    argv = args.data();
+    if (argc < 2) return usage(); // only options were given
 
     std::string command = argv[1];
+    int status = 0;
 
     if (command == "generate") {
         if (argc < 3) return 1;
@@ -151,6 +438,9 @@ int main(int argc, char* argv[]) {
     } else if (command == "run") {
         if (argc < 3) return 1;
         cmd_run(argv[2]);
+    } else if (command == "check") {
+        if (argc < 3) return 1;
+        status = cmd_check(std::vector<std::string>(argv + 2, argv + argc)) ? 0 : 1;
     } else if (command == "format") {
         if (argc < 3) return 1;
         cmd_format(argv[2]);
@@ -159,5 +449,7 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    return 0;
+    if (timePasses == "text") std::cerr << passTimes.text();
+    else if (timePasses == "json") std::cerr << passTimes.json();
+    return status;
 }
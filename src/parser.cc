@@ -1,5 +1,4 @@
 #include "parser.h"
-#include <iostream>
 
 namespace rox {
 
@@ -7,8 +6,12 @@ Parser::Parser(const std::vector<Token>& tokens) : tokens(tokens) {}
 
 std::vector<std::unique_ptr<Stmt>> Parser::parse() {
     std::vector<std::unique_ptr<Stmt>> statements;
-    while (!isAtEnd()) {
-        statements.push_back(declaration());
+    try {
+        while (!isAtEnd()) {
+            statements.push_back(declaration());
+        }
+    } catch (const ParseError&) {
+        // reported in errors
     }
     return statements;
 }
@@ -25,7 +28,8 @@ std::unique_ptr<Stmt> Parser::declaration() {
     if (check(TokenType::TYPE_INT64) ||
         check(TokenType::TYPE_FLOAT64) || check(TokenType::TYPE_BOOL) ||
         check(TokenType::TYPE_CHAR) || check(TokenType::TYPE_STRING) ||
-        check(TokenType::TYPE_LIST) ||
+        check(TokenType::TYPE_FILE_VIEW) || check(TokenType::TYPE_LIST) ||
+        check(TokenType::TYPE_SOA_LIST) || check(TokenType::TYPE_TASK) ||
         check(TokenType::TYPE_DICT) || check(TokenType::TYPE_ROX_RESULT) ||
         check(TokenType::NONE) || check(TokenType::FUNCTION)) {
         return varDeclaration();
@@ -90,7 +94,7 @@ std::unique_ptr<Stmt> Parser::varDeclaration() {
     // If we matched TYPE, previous() is ... wait, we used check() for TYPE in caller.
     // But for CONST we utilized match(), so previous is CONST.
 
-    if (previous().type == TokenType::CONST) {
+    if (current > 0 && previous().type == TokenType::CONST) {
         isConst = true;
     }
 
@@ -116,6 +120,10 @@ std::unique_ptr<Stmt> Parser::varDeclaration() {
 std::unique_ptr<Stmt> Parser::statement() {
     if (match({TokenType::IF})) return ifStatement();
     if (match({TokenType::FOR})) return forStatement();
+    if (match({TokenType::PARALLEL})) {
+        consume(TokenType::FOR, "Expect 'for' after 'parallel'.");
+        return forStatement(true);
+    }
     if (match({TokenType::BREAK})) return breakStatement();
     if (match({TokenType::CONTINUE})) return continueStatement();
     if (match({TokenType::RETURN})) return returnStatement();
@@ -153,8 +161,12 @@ std::unique_ptr<Stmt> Parser::ifStatement() {
     return std::make_unique<IfStmt>(std::move(condition), std::move(thenBranch), std::move(elseBranch));
 }
 
-std::unique_ptr<Stmt> Parser::forStatement() {
+std::unique_ptr<Stmt> Parser::forStatement(bool parallel) {
     Token iterator = consume(TokenType::IDENTIFIER, "Expect iterator name after 'for'.");
+    Token valueIterator{TokenType::IDENTIFIER, "", iterator.line};
+    if (match({TokenType::COMMA})) {
+        valueIterator = consume(TokenType::IDENTIFIER, "Expect value name after ',' in 'for'.");
+    }
 
     // Check for 'in' keyword which might be lexed as IDENTIFIER "in"
     if (check(TokenType::IDENTIFIER) && peek().lexeme == "in") {
@@ -169,9 +181,28 @@ std::unique_ptr<Stmt> Parser::forStatement() {
     // Parse the iterable expression (e.g. range(0, 5, 1))
     std::unique_ptr<Expr> iterable = expression();
 
+    // Optional reduction clause on parallel loops: reduce(total: +, best: max)
+    std::vector<ForStmt::Reduction> reductions;
+    if (parallel && check(TokenType::IDENTIFIER) && peek().lexeme == "reduce") {
+        advance();
+        consume(TokenType::LEFT_PAREN, "Expect '(' after 'reduce'.");
+        do {
+            Token name = consume(TokenType::IDENTIFIER, "Expect variable name in reduce clause.");
+            consume(TokenType::COLON, "Expect ':' after reduction variable.");
+            if (!match({TokenType::PLUS, TokenType::STAR, TokenType::IDENTIFIER})) {
+                error(peek(), "Expect reduction operator (+, *, min, max).");
+            }
+            reductions.push_back({name, previous()});
+        } while (match({TokenType::COMMA}));
+        consume(TokenType::RIGHT_PAREN, "Expect ')' after reduce clause.");
+    }
+
     std::unique_ptr<Stmt> body = statement();
 
-    return std::make_unique<ForStmt>(iterator, std::move(iterable), std::move(body));
+    auto stmt = std::make_unique<ForStmt>(iterator, valueIterator, std::move(iterable), std::move(body));
+    stmt->parallel = parallel;
+    stmt->reductions = std::move(reductions);
+    return stmt;
 }
 
 std::unique_ptr<Stmt> Parser::returnStatement() {
@@ -421,7 +452,8 @@ std::unique_ptr<Expr> Parser::primary() {
 
 std::unique_ptr<Type> Parser::type() {
     if (match({TokenType::TYPE_INT64, TokenType::TYPE_FLOAT64,
-               TokenType::TYPE_BOOL, TokenType::TYPE_CHAR, TokenType::TYPE_STRING, TokenType::NONE})) {
+               TokenType::TYPE_BOOL, TokenType::TYPE_CHAR, TokenType::TYPE_STRING, TokenType::TYPE_FILE_VIEW,
+               TokenType::NONE})) {
         return std::make_unique<PrimitiveType>(previous());
     }
 
@@ -432,6 +464,20 @@ std::unique_ptr<Type> Parser::type() {
         return std::make_unique<ListType>(std::move(elementType));
     }
 
+    if (match({TokenType::TYPE_SOA_LIST})) {
+        consume(TokenType::LEFT_BRACKET, "Expect '[' after soa_list.");
+        std::unique_ptr<Type> elementType = type();
+        consume(TokenType::RIGHT_BRACKET, "Expect ']' after soa_list type.");
+        return std::make_unique<SoaListType>(std::move(elementType));
+    }
+
+    if (match({TokenType::TYPE_TASK})) {
+        consume(TokenType::LEFT_BRACKET, "Expect '[' after task.");
+        std::unique_ptr<Type> resultType = type();
+        consume(TokenType::RIGHT_BRACKET, "Expect ']' after task type.");
+        return std::make_unique<TaskType>(std::move(resultType));
+    }
+
     if (match({TokenType::TYPE_DICT})) {
         consume(TokenType::LEFT_BRACKET, "Expect '[' after dictionary.");
         std::unique_ptr<Type> keyType = type();
@@ -533,13 +579,10 @@ void Parser::synchronize() {
     }
 }
 
+// Parsing stops at the first error: the statements after it would only add noise.
 void Parser::error(Token token, std::string message) {
-    std::cerr << "[line " << token.line << "] Error at '" << token.lexeme << "': " << message << std::endl;
-    // For now, simpler error handling (maybe throw?)
-    // But since this is a simple compiler, printing to stderr is okay.
-    // However, we should probably throw to stop parsing or resync.
-    // For v0, let's just print and maybe exit or skip.
-    exit(1);
+    errors.push_back({token.line, "Error at '" + token.lexeme + "': " + message});
+    throw ParseError{};
 }
 
 } // namespace rox
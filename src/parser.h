@@ -12,10 +12,14 @@ class Parser {
 public:
     Parser(const std::vector<Token>& tokens);
     std::vector<std::unique_ptr<Stmt>> parse();
+    // The error that stopped parse(), if any; the statements before it are still returned.
+    const std::vector<Diagnostic>& diagnostics() const { return errors; }
 
 private:
     const std::vector<Token>& tokens;
     size_t current = 0;
+    std::vector<Diagnostic> errors;
+    struct ParseError {}; // thrown by error()
 
     std::unique_ptr<Stmt> declaration();
     std::unique_ptr<Stmt> functionDeclaration(std::string kind);
@@ -23,7 +27,7 @@ private:
     std::unique_ptr<Stmt> varDeclaration();
     std::unique_ptr<Stmt> statement();
     std::unique_ptr<Stmt> ifStatement();
-    std::unique_ptr<Stmt> forStatement();
+    std::unique_ptr<Stmt> forStatement(bool parallel = false);
     std::unique_ptr<Stmt> returnStatement();
     std::unique_ptr<Stmt> breakStatement();
     std::unique_ptr<Stmt> continueStatement();
@@ -0,0 +1,768 @@
+#include "sema.h"
+#include "lexer.h"
+#include <functional>
+#include <unordered_set>
+
+namespace rox {
+
+Type* TypeTable::intern(const Type& type) {
+    auto& slot = types[type.toString()];
+    if (!slot) slot = type.clone();
+    return slot.get();
+}
+
+Type* TypeTable::list(Type* element) { return intern(ListType(element->clone())); }
+Type* TypeTable::result(Type* value) { return intern(RoxResultType(value->clone())); }
+Type* TypeTable::task(Type* result) { return intern(TaskType(result->clone())); }
+
+static std::string str(Type* type) { return type ? type->toString() : "?"; }
+
+Sema::Sema(const std::vector<std::unique_ptr<Stmt>>& statements) : statements(statements) {
+    int64Type = types.intern(PrimitiveType(Token{TokenType::TYPE_INT64, "int64", 0}));
+    float64Type = types.intern(PrimitiveType(Token{TokenType::TYPE_FLOAT64, "float64", 0}));
+    boolType = types.intern(PrimitiveType(Token{TokenType::TYPE_BOOL, "bool", 0}));
+    charType = types.intern(PrimitiveType(Token{TokenType::TYPE_CHAR, "char", 0}));
+    stringType = types.intern(PrimitiveType(Token{TokenType::TYPE_STRING, "string", 0}));
+    noneType = types.intern(PrimitiveType(Token{TokenType::NONE, "none", 0}));
+    fileViewType = types.intern(PrimitiveType(Token{TokenType::TYPE_FILE_VIEW, "file_view", 0}));
+
+    Type* i = int64Type;
+    Type* f = float64Type;
+    Type* ints = types.list(i);
+    Type* floats = types.list(f);
+    signatures = {
+        {"int64_abs", {{i}, i}}, {"int64_min", {{i, i}, i}}, {"int64_max", {{i, i}, i}},
+        {"int64_pow", {{i, i}, types.result(i)}},
+        {"float64_abs", {{f}, f}}, {"float64_min", {{f, f}, f}}, {"float64_max", {{f, f}, f}},
+        {"float64_pow", {{f, f}, f}}, {"float64_sqrt", {{f}, types.result(f)}}, {"float64_log", {{f}, types.result(f)}},
+        {"float64_sin", {{f}, f}}, {"float64_cos", {{f}, f}}, {"float64_tan", {{f}, f}},
+        {"float64_exp", {{f}, f}}, {"float64_floor", {{f}, f}}, {"float64_ceil", {{f}, f}},
+        {"int64_sum", {{ints}, i}}, {"int64_list_min", {{ints}, types.result(i)}}, {"int64_list_max", {{ints}, types.result(i)}},
+        {"float64_sum", {{floats}, f}}, {"float64_sum_kahan", {{floats}, f}}, {"float64_dot", {{floats, floats}, types.result(f)}},
+        {"read_line", {{}, types.result(stringType)}}, {"read_int64", {{}, types.result(i)}},
+        {"read_float64", {{}, types.result(f)}},
+        {"read_file", {{stringType}, types.result(stringType)}}, {"map_file", {{stringType}, types.result(fileViewType)}},
+    };
+}
+
+bool Sema::check() {
+    for (const auto& stmt : statements) {
+        if (auto* td = dynamic_cast<TypeDefStmt*>(stmt.get())) {
+            if (!records.emplace(td->name.lexeme, td).second) {
+                error(td->name.line, "Compile Error: Type '" + td->name.lexeme + "' is already defined.");
+            }
+        } else if (auto* fn = dynamic_cast<FunctionStmt*>(stmt.get())) {
+            if (!functions.emplace(fn->name.lexeme, fn).second) {
+                error(fn->name.line, "Compile Error: Function '" + fn->name.lexeme + "' is already defined.");
+            }
+        }
+    }
+
+    for (const auto& stmt : statements) {
+        auto* td = dynamic_cast<TypeDefStmt*>(stmt.get());
+        if (!td) continue;
+        std::unordered_set<std::string> names;
+        for (const auto& f : td->fields) {
+            if (!names.insert(f.name.lexeme).second) {
+                error(f.name.line, "Compile Error: Duplicate field '" + f.name.lexeme + "' in type '" + td->name.lexeme + "'.");
+            }
+            resolve(f.type.get(), f.name.line);
+        }
+    }
+
+    // Globals are visible to the declarations that follow them, as in the generated C++.
+    scopes.push_back({});
+    for (const auto& stmt : statements) {
+        if (auto* fn = dynamic_cast<FunctionStmt*>(stmt.get())) checkFunction(fn);
+        else if (auto* let = dynamic_cast<LetStmt*>(stmt.get())) checkLet(let);
+        else if (!dynamic_cast<TypeDefStmt*>(stmt.get())) {
+            checkStmt(stmt.get());
+            error(line, "Compile Error: Only functions, types and variables can be declared at the top level.");
+        }
+    }
+    scopes.clear();
+    return errors.empty();
+}
+
+void Sema::error(int at, const std::string& message) {
+    errors.push_back({at > 0 ? at : line, message});
+}
+
+// Interns a type written in the source after checking the record names it mentions.
+Type* Sema::resolve(Type* written, int at) {
+    if (!written) return nullptr;
+    bool valid = true;
+    std::function<void(Type*)> visit = [&](Type* t) {
+        if (auto* r = dynamic_cast<RecordType*>(t)) {
+            if (!records.count(r->name)) {
+                error(at, "Compile Error: Unknown type '" + r->name + "'.");
+                valid = false;
+            }
+        } else if (auto* l = dynamic_cast<ListType*>(t)) {
+            if (dynamic_cast<SoaListType*>(l) && !dynamic_cast<RecordType*>(l->elementType.get())) {
+                error(at, "Compile Error: soa_list elements must be a record type, not " + l->elementType->toString() + ".");
+                valid = false;
+            }
+            visit(l->elementType.get());
+        } else if (auto* d = dynamic_cast<DictionaryType*>(t)) {
+            // Keys need a std::hash, which the runtime has for these only.
+            auto* key = dynamic_cast<PrimitiveType*>(d->keyType.get());
+            static const std::unordered_set<TokenType> hashable = {TokenType::TYPE_INT64, TokenType::TYPE_FLOAT64,
+                TokenType::TYPE_BOOL, TokenType::TYPE_CHAR, TokenType::TYPE_STRING};
+            if (!key || !hashable.count(key->token.type)) {
+                error(at, "Compile Error: Dictionary keys must be int64, float64, bool, char or string, not " +
+                          d->keyType->toString() + ".");
+                valid = false;
+            }
+            visit(d->keyType.get());
+            visit(d->valueType.get());
+        } else if (auto* k = dynamic_cast<TaskType*>(t)) {
+            visit(k->resultType.get());
+        } else if (auto* r = dynamic_cast<RoxResultType*>(t)) {
+            visit(r->valueType.get());
+        } else if (auto* f = dynamic_cast<FunctionType*>(t)) {
+            for (const auto& p : f->paramTypes) visit(p.get());
+            visit(f->returnType.get());
+        }
+    };
+    visit(written);
+    return valid ? types.intern(*written) : nullptr;
+}
+
+Type* Sema::functionType(FunctionStmt* fn) {
+    std::vector<std::unique_ptr<Type>> params;
+    for (const auto& p : fn->params) params.push_back(p.type->clone());
+    return types.intern(FunctionType(std::move(params), fn->returnType->clone()));
+}
+
+void Sema::declare(const Token& name, Type* type, bool isConst) {
+    if (!scopes.back().emplace(name.lexeme, Symbol{type, isConst}).second) {
+        error(name.line, "Compile Error: '" + name.lexeme + "' is already declared in this scope.");
+    }
+}
+
+auto Sema::lookup(const std::string& name) -> Symbol* {
+    for (auto it = scopes.rbegin(); it != scopes.rend(); ++it) {
+        auto found = it->find(name);
+        if (found != it->end()) return &found->second;
+    }
+    return nullptr;
+}
+
+// A file_view converts to a string by copying its bytes; otherwise types must match.
+// Unknown types (already reported) are assignable to anything.
+bool Sema::assignable(Type* to, Type* from) {
+    return !to || !from || to == from || (to == stringType && from == fileViewType);
+}
+
+// True if `callee` names the builtin `name`, i.e. no user declaration hides it.
+bool Sema::isBuiltinCall(Expr* callee, const std::string& name) {
+    auto* var = dynamic_cast<VariableExpr*>(callee);
+    return var && var->name.lexeme == name && !lookup(name) && !functions.count(name);
+}
+
+// --- Statements ---
+
+void Sema::checkStmt(Stmt* stmt) {
+    if (!stmt) return;
+    if (auto* s = dynamic_cast<BlockStmt*>(stmt)) {
+        scopes.push_back({});
+        for (const auto& c : s->statements) checkStmt(c.get());
+        scopes.pop_back();
+    } else if (auto* s = dynamic_cast<IfStmt*>(stmt)) {
+        line = lineOf(s->condition.get());
+        Type* cond = checkExpr(s->condition.get());
+        if (cond && cond != boolType) error(line, "Type Error: if condition must be bool, got " + str(cond) + ".");
+        checkStmt(s->thenBranch.get());
+        checkStmt(s->elseBranch.get());
+    } else if (auto* s = dynamic_cast<ForStmt*>(stmt)) {
+        checkFor(s);
+    } else if (auto* s = dynamic_cast<ReturnStmt*>(stmt)) {
+        checkReturn(s);
+    } else if (auto* s = dynamic_cast<LetStmt*>(stmt)) {
+        checkLet(s);
+    } else if (auto* s = dynamic_cast<ExprStmt*>(stmt)) {
+        line = lineOf(s->expression.get());
+        checkExpr(s->expression.get());
+    } else if (auto* s = dynamic_cast<BreakStmt*>(stmt)) {
+        if (loopDepth == 0) error(s->keyword.line, "Compile Error: 'break' outside of a loop.");
+    } else if (auto* s = dynamic_cast<ContinueStmt*>(stmt)) {
+        if (loopDepth == 0) error(s->keyword.line, "Compile Error: 'continue' outside of a loop.");
+    } else if (auto* s = dynamic_cast<FunctionStmt*>(stmt)) {
+        error(s->name.line, "Compile Error: Function '" + s->name.lexeme + "' must be declared at the top level.");
+    } else if (auto* s = dynamic_cast<TypeDefStmt*>(stmt)) {
+        error(s->name.line, "Compile Error: Type '" + s->name.lexeme + "' must be declared at the top level.");
+    }
+}
+
+void Sema::checkFunction(FunctionStmt* stmt) {
+    currentFunction = stmt;
+    line = stmt->name.line;
+    scopes.push_back({});
+    for (const auto& p : stmt->params) declare(p.name, resolve(p.type.get(), p.name.line), false);
+    returnType = resolve(stmt->returnType.get(), stmt->name.line);
+    for (const auto& s : stmt->body) checkStmt(s.get());
+    scopes.pop_back();
+    currentFunction = nullptr;
+    returnType = nullptr;
+}
+
+void Sema::checkLet(LetStmt* stmt) {
+    line = stmt->name.line;
+    Type* type = resolve(stmt->type.get(), line);
+    if (stmt->initializer) {
+        Type* value = checkExpr(stmt->initializer.get(), type);
+        if (!assignable(type, value)) {
+            error(line, "Type Error: Cannot initialize '" + stmt->name.lexeme + "' of type " + str(type) +
+                        " with a value of type " + str(value) + ".");
+        }
+    } else if (dynamic_cast<RecordType*>(stmt->type.get())) {
+        error(line, "Compile Error: Uninitialized record. Use default(" + stmt->type->toString() +
+                    ") or an explicit initializer.");
+    }
+    declare(stmt->name, type, stmt->isConst);
+}
+
+void Sema::checkReturn(ReturnStmt* stmt) {
+    line = stmt->keyword.line;
+    if (!currentFunction) return;
+    const std::string& name = currentFunction->name.lexeme;
+    if (!stmt->value) {
+        if (returnType && returnType != noneType) {
+            error(line, "Type Error: Function '" + name + "' must return a value of type " + str(returnType) + ".");
+        }
+        return;
+    }
+    Type* value = checkExpr(stmt->value.get(), returnType);
+    if (!assignable(returnType, value)) {
+        error(line, "Type Error: Function '" + name + "' returns " + str(returnType) + " but got " + str(value) + ".");
+    }
+}
+
+// range(), stdin_lines() and file_view.lines() are typed as the list they iterate like.
+void Sema::checkFor(ForStmt* stmt) {
+    line = stmt->iterator.line;
+    forIterable = stmt->iterable.get();
+    Type* iterable = checkExpr(stmt->iterable.get());
+    forIterable = nullptr;
+
+    Type* key = nullptr;
+    Type* value = nullptr;
+    if (stmt->isEntryLoop()) {
+        auto* call = dynamic_cast<CallExpr*>(stmt->iterable.get());
+        if (call && isBuiltinCall(call->callee.get(), "range")) {
+            error(line, "Compile Error: range() loops take a single iterator.");
+        } else if (auto* dict = dynamic_cast<DictionaryType*>(iterable)) {
+            key = types.intern(*dict->keyType);
+            value = types.intern(*dict->valueType);
+        } else if (iterable) {
+            error(line, "Compile Error: 'for " + stmt->iterator.lexeme + ", " + stmt->valueIterator.lexeme +
+                        " in ...' requires a dictionary, got " + str(iterable) + ".");
+        }
+    } else if (auto* list = dynamic_cast<ListType*>(iterable)) {
+        key = types.intern(*list->elementType);
+    } else if (iterable) {
+        std::string hint = dynamic_cast<DictionaryType*>(iterable) ? " Use 'for key, value in ...'." : "";
+        error(line, "Compile Error: Cannot iterate over " + str(iterable) + "." + hint);
+    }
+
+    scopes.push_back({});
+    declare(stmt->iterator, key, false);
+    if (stmt->isEntryLoop()) declare(stmt->valueIterator, value, false);
+    loopDepth++;
+    checkStmt(stmt->body.get());
+    loopDepth--;
+    scopes.pop_back();
+}
+
+// --- Expressions ---
+
+// `expected` is the type the context requires, if known: it gives empty list literals
+// their element type and lets a list literal initialize a soa_list.
+Type* Sema::checkExpr(Expr* expr, Type* expected) {
+    if (!expr) return nullptr;
+    Type* type = nullptr;
+    int at = lineOf(expr);
+
+    if (auto* e = dynamic_cast<LiteralExpr*>(expr)) {
+        switch (e->value.type) {
+            case TokenType::NUMBER_INT: type = int64Type; break;
+            case TokenType::NUMBER_FLOAT: type = float64Type; break;
+            case TokenType::STRING: type = stringType; break;
+            case TokenType::CHAR_LITERAL: type = charType; break;
+            case TokenType::TRUE:
+            case TokenType::FALSE: type = boolType; break;
+            case TokenType::NONE: type = noneType; break;
+            default: break;
+        }
+    } else if (auto* e = dynamic_cast<VariableExpr*>(expr)) {
+        type = checkVariable(e);
+    } else if (auto* e = dynamic_cast<AssignmentExpr*>(expr)) {
+        Symbol* target = lookup(e->name.lexeme);
+        if (!target) {
+            error(at, "Compile Error: Undefined variable '" + e->name.lexeme + "'.");
+            checkExpr(e->value.get());
+        } else {
+            if (target->isConst) error(at, "Compile Error: Cannot assign to const '" + e->name.lexeme + "'.");
+            Type* value = checkExpr(e->value.get(), target->type);
+            if (!assignable(target->type, value)) {
+                error(at, "Type Error: Cannot assign " + str(value) + " to '" + e->name.lexeme + "' of type " +
+                          str(target->type) + ".");
+            }
+            type = target->type;
+        }
+    } else if (auto* e = dynamic_cast<UnaryExpr*>(expr)) {
+        Type* operand = checkExpr(e->right.get());
+        if (e->op.type == TokenType::NOT) {
+            if (operand && operand != boolType) error(at, "Type Error: 'not' expects bool, got " + str(operand) + ".");
+            type = boolType;
+        } else {
+            if (operand && operand != int64Type && operand != float64Type) {
+                error(at, "Type Error: Unary '" + e->op.lexeme + "' expects int64 or float64, got " + str(operand) + ".");
+            } else {
+                type = operand;
+            }
+        }
+    } else if (auto* e = dynamic_cast<BinaryExpr*>(expr)) {
+        type = checkBinary(e);
+    } else if (auto* e = dynamic_cast<LogicalExpr*>(expr)) {
+        Type* left = checkExpr(e->left.get());
+        Type* right = checkExpr(e->right.get());
+        if ((left && left != boolType) || (right && right != boolType)) {
+            error(at, "Type Error: '" + e->op.lexeme + "' expects bool operands, got " + str(left) + " and " + str(right) + ".");
+        }
+        type = boolType;
+    } else if (auto* e = dynamic_cast<CallExpr*>(expr)) {
+        type = checkCall(e, expected);
+    } else if (auto* e = dynamic_cast<MethodCallExpr*>(expr)) {
+        type = checkMethodCall(e);
+    } else if (auto* e = dynamic_cast<ListLiteralExpr*>(expr)) {
+        type = checkListLiteral(e, expected);
+    } else if (auto* e = dynamic_cast<RecordInitExpr*>(expr)) {
+        type = checkRecordInit(e);
+    } else if (auto* e = dynamic_cast<FieldAccessExpr*>(expr)) {
+        type = fieldType(checkExpr(e->object.get()), e->fieldName);
+    } else if (auto* e = dynamic_cast<FieldAssignExpr*>(expr)) {
+        auto* var = dynamic_cast<VariableExpr*>(e->object.get());
+        Symbol* owner = var ? lookup(var->name.lexeme) : nullptr;
+        if (owner && owner->isConst) error(at, "Compile Error: Cannot assign to a field of const '" + var->name.lexeme + "'.");
+        type = fieldType(checkExpr(e->object.get()), e->fieldName);
+        Type* value = checkExpr(e->value.get(), type);
+        if (!assignable(type, value)) {
+            error(at, "Type Error: Field '" + e->fieldName.lexeme + "' expects " + str(type) + " but got " + str(value) + ".");
+        }
+    } else if (auto* e = dynamic_cast<DefaultExpr*>(expr)) {
+        type = resolve(e->type.get(), at);
+    } else if (auto* e = dynamic_cast<OkExpr*>(expr)) {
+        Type* value = checkExpr(e->value.get());
+        if (value) type = types.result(value);
+    }
+
+    expr->type = type;
+    return type;
+}
+
+Type* Sema::checkVariable(VariableExpr* expr) {
+    const std::string& name = expr->name.lexeme;
+    if (Symbol* symbol = lookup(name)) return symbol->type;
+    if (auto it = functions.find(name); it != functions.end()) {
+        expr->function = it->second;
+        return functionType(it->second);
+    }
+    if (name == "pi" || name == "e") return float64Type;
+    if (name == "EOF") return stringType;
+    if (name == "print" || name == "read_line" || Lexer::getBuiltins().count(name)) {
+        error(expr->name.line, "Compile Error: Built-in '" + name + "' can only be called.");
+        return nullptr;
+    }
+    error(expr->name.line, "Compile Error: Undefined variable '" + name + "'.");
+    return nullptr;
+}
+
+Type* Sema::checkBinary(BinaryExpr* expr) {
+    Type* left = checkExpr(expr->left.get());
+    Type* right = checkExpr(expr->right.get());
+    const std::string& op = expr->op.lexeme;
+    int at = expr->op.line;
+    bool number = left == int64Type || left == float64Type;
+
+    switch (expr->op.type) {
+        case TokenType::PLUS:
+        case TokenType::MINUS:
+        case TokenType::STAR:
+            if (!left || !right) return left ? left : right;
+            if (left == right && number) return left;
+            error(at, "Type Error: '" + op + "' expects two int64 or two float64 operands, got " + str(left) + " and " + str(right) + ".");
+            return nullptr;
+        case TokenType::SLASH:
+            if (!left || !right) return nullptr;
+            if (left == right && number) return types.result(left);
+            error(at, "Type Error: '/' expects two int64 or two float64 operands, got " + str(left) + " and " + str(right) + ".");
+            return nullptr;
+        case TokenType::PERCENT:
+            if (!left || !right) return nullptr;
+            if (left == int64Type && right == int64Type) return types.result(left);
+            error(at, "Type Error: '%' expects two int64 operands, got " + str(left) + " and " + str(right) + ".");
+            return nullptr;
+        case TokenType::EQUAL_EQUAL:
+            if (left == fileViewType) left = stringType; // line views and slices compare as strings
+            if (right == fileViewType) right = stringType;
+            if (left && right && (left != right || !dynamic_cast<PrimitiveType*>(left) || left == noneType)) {
+                error(at, "Type Error: Cannot compare " + str(left) + " with " + str(right) + " using '=='.");
+            }
+            return boolType;
+        default: // < <= > >=
+            if (left && right && (left != right || !(number || left == charType || left == stringType))) {
+                error(at, "Type Error: Cannot order " + str(left) + " and " + str(right) + " with '" + op + "'.");
+            }
+            return boolType;
+    }
+}
+
+Type* Sema::checkCall(CallExpr* expr, Type* expected) {
+    auto* var = dynamic_cast<VariableExpr*>(expr->callee.get());
+    if (var && !lookup(var->name.lexeme) && !functions.count(var->name.lexeme)) {
+        return checkBuiltin(expr, var->name.lexeme, expected);
+    }
+
+    int at = expr->paren.line;
+    std::string what = var ? "'" + var->name.lexeme + "'" : "Function value";
+    auto* fn = dynamic_cast<FunctionType*>(checkExpr(expr->callee.get()));
+    if (!fn) {
+        if (expr->callee->type) error(at, "Compile Error: " + what + " of type " + str(expr->callee->type) + " is not a function.");
+        for (const auto& a : expr->arguments) checkExpr(a.get());
+        return nullptr;
+    }
+    if (expr->arguments.size() != fn->paramTypes.size()) {
+        error(at, "Compile Error: " + what + " expects " + std::to_string(fn->paramTypes.size()) + " argument(s) but got " +
+                  std::to_string(expr->arguments.size()) + ".");
+    }
+    for (size_t i = 0; i < expr->arguments.size(); ++i) {
+        Type* want = i < fn->paramTypes.size() ? types.intern(*fn->paramTypes[i]) : nullptr;
+        Type* got = checkExpr(expr->arguments[i].get(), want);
+        if (!assignable(want, got)) {
+            error(at, "Type Error: Argument " + std::to_string(i + 1) + " of " + what + " expects " + str(want) +
+                      " but got " + str(got) + ".");
+        }
+    }
+    return types.intern(*fn->returnType);
+}
+
+Type* Sema::checkBuiltin(CallExpr* expr, const std::string& name, Type* expected) {
+    int at = expr->paren.line;
+    const auto& args = expr->arguments;
+    auto arity = [&](size_t n) {
+        if (args.size() == n) return true;
+        error(at, "Compile Error: '" + name + "' expects " + std::to_string(n) + " argument(s) but got " +
+                  std::to_string(args.size()) + ".");
+        return false;
+    };
+    auto mismatch = [&](size_t i, Type* want, Type* got) {
+        if (assignable(want, got)) return false;
+        error(at, "Type Error: Argument " + std::to_string(i + 1) + " of '" + name + "' expects " + str(want) +
+                  " but got " + str(got) + ".");
+        return true;
+    };
+
+    if (auto sig = signatures.find(name); sig != signatures.end()) {
+        const auto& [params, result] = sig->second;
+        arity(params.size());
+        for (size_t i = 0; i < args.size(); ++i) {
+            Type* want = i < params.size() ? params[i] : nullptr;
+            mismatch(i, want, checkExpr(args[i].get(), want));
+        }
+        return result;
+    }
+
+    if (name == "range" || name == "stdin_lines") {
+        if (expr != forIterable) {
+            error(at, "Compile Error: " + name + "() can only be used as the iterable of a for loop.");
+            for (const auto& a : args) checkExpr(a.get());
+            return nullptr;
+        }
+        if (name == "stdin_lines") {
+            arity(0);
+            return types.list(stringType);
+        }
+        if (args.size() != 3) error(at, "Compile Error: range() requires exactly 3 arguments: range(start, end, step).");
+        for (const auto& a : args) {
+            Type* t = checkExpr(a.get(), int64Type);
+            if (t && t != int64Type) error(at, "Type Error: range() arguments must be int64, got " + str(t) + ".");
+        }
+        return types.list(int64Type);
+    }
+
+    std::vector<Type*> got;
+    for (const auto& a : args) got.push_back(checkExpr(a.get()));
+    auto list = [&](size_t i) -> ListType* {
+        auto* l = dynamic_cast<ListType*>(got[i]);
+        if (got[i] && (!l || dynamic_cast<SoaListType*>(l))) {
+            error(at, "Type Error: Argument " + std::to_string(i + 1) + " of '" + name + "' expects a list, got " + str(got[i]) + ".");
+            return nullptr;
+        }
+        return l;
+    };
+    auto function = [&](size_t i, size_t params) -> FunctionType* {
+        auto* f = dynamic_cast<FunctionType*>(got[i]);
+        if (got[i] && (!f || f->paramTypes.size() != params)) {
+            error(at, "Type Error: Argument " + std::to_string(i + 1) + " of '" + name + "' expects a function of " +
+                      std::to_string(params) + " parameter(s), got " + str(got[i]) + ".");
+            return nullptr;
+        }
+        return f;
+    };
+    auto element = [&](ListType* l) { return types.intern(*l->elementType); };
+    auto param = [&](FunctionType* f, size_t i) { return types.intern(*f->paramTypes[i]); };
+    auto returns = [&](FunctionType* f) { return types.intern(*f->returnType); };
+
+    if (name == "print") {
+        // rox_write has overloads for scalars and text only; a list[char] prints as its characters.
+        for (size_t i = 0; i < got.size(); ++i) {
+            auto* l = dynamic_cast<ListType*>(got[i]);
+            bool text = l && !dynamic_cast<SoaListType*>(l) && element(l) == charType;
+            if (!got[i] || got[i] == int64Type || got[i] == float64Type || got[i] == boolType || got[i] == charType ||
+                got[i] == stringType || got[i] == fileViewType || text) continue;
+            error(at, "Type Error: Argument " + std::to_string(i + 1) + " of 'print' has type " + str(got[i]) +
+                      ", which cannot be printed.");
+        }
+        return noneType;
+    }
+    if (name == "isOk" || name == "getValue" || name == "getError") {
+        if (!arity(1)) return nullptr;
+        auto* r = dynamic_cast<RoxResultType*>(got[0]);
+        if (got[0] && !r) error(at, "Type Error: '" + name + "' expects a rox_result, got " + str(got[0]) + ".");
+        if (name == "isOk") return boolType;
+        if (name == "getError") return stringType;
+        return r ? types.intern(*r->valueType) : nullptr;
+    }
+    if (name == "ok") {
+        if (!arity(1) || !got[0]) return nullptr;
+        return types.result(got[0]);
+    }
+    if (name == "error") {
+        if (arity(1)) mismatch(0, stringType, got[0]);
+        return dynamic_cast<RoxResultType*>(expected) ? expected : nullptr;
+    }
+    if (name == "count_equal") {
+        if (!arity(2)) return int64Type;
+        if (ListType* l = list(0)) mismatch(1, element(l), got[1]);
+        return int64Type;
+    }
+    if (name == "sort_by" || name == "parallel_map" || name == "parallel_filter") {
+        if (!arity(2)) return nullptr;
+        ListType* l = list(0);
+        FunctionType* f = function(1, 1);
+        if (!l || !f) return nullptr;
+        std::vector<std::unique_ptr<Type>> params;
+        params.push_back(l->elementType->clone());
+        mismatch(1, types.intern(FunctionType(std::move(params), f->returnType->clone())), got[1]);
+        if (name == "parallel_filter" && returns(f) != boolType) {
+            error(at, "Type Error: 'parallel_filter' expects a predicate returning bool, got " + str(got[1]) + ".");
+        }
+        return name == "parallel_map" ? types.list(returns(f)) : got[0];
+    }
+    if (name == "parallel_reduce") {
+        if (!arity(3)) return nullptr;
+        // Chunk results are combined like elements, so everything has the element type.
+        ListType* l = list(0);
+        FunctionType* f = function(2, 2);
+        if (!l) return nullptr;
+        mismatch(1, element(l), got[1]);
+        if (!f) return element(l);
+        std::vector<std::unique_ptr<Type>> params;
+        params.push_back(l->elementType->clone());
+        params.push_back(l->elementType->clone());
+        mismatch(2, types.intern(FunctionType(std::move(params), l->elementType->clone())), got[2]);
+        return element(l);
+    }
+    if (name == "spawn") {
+        if (args.empty()) {
+            arity(1);
+            return nullptr;
+        }
+        FunctionType* f = function(0, args.size() - 1);
+        if (!f) return nullptr;
+        for (size_t i = 1; i < args.size(); ++i) mismatch(i, param(f, i - 1), got[i]);
+        return types.task(returns(f));
+    }
+    if (name == "join") {
+        if (!arity(1)) return nullptr;
+        auto* t = dynamic_cast<TaskType*>(got[0]);
+        if (got[0] && !t) error(at, "Type Error: 'join' expects a task, got " + str(got[0]) + ".");
+        return t ? types.intern(*t->resultType) : nullptr;
+    }
+    if (Lexer::getBuiltins().count(name)) return nullptr; // runtime helpers: left to the C++ compiler
+    error(at, "Compile Error: Undefined function '" + name + "'.");
+    return nullptr;
+}
+
+Type* Sema::checkMethodCall(MethodCallExpr* expr) {
+    Type* object = checkExpr(expr->object.get());
+    const std::string& method = expr->name.lexeme;
+    int at = expr->name.line;
+    auto rest = [&]() {
+        for (const auto& a : expr->arguments) checkExpr(a.get());
+        return nullptr;
+    };
+    if (!object) return rest();
+
+    std::string receiver = object->toString();
+    std::vector<Type*> params;
+    Type* result = nullptr;
+    bool known = true;
+    if (auto* l = dynamic_cast<ListType*>(object)) {
+        receiver = dynamic_cast<SoaListType*>(l) ? "soa_list" : "list";
+        Type* element = types.intern(*l->elementType);
+        if (method == "size") result = int64Type;
+        else if (method == "append") params = {element}, result = noneType;
+        else if (method == "pop") result = noneType;
+        else if (method == "at") params = {int64Type}, result = types.result(element);
+        else if (method == "set") params = {int64Type, element}, result = noneType;
+        else if (method == "sort") {
+            result = noneType;
+            bool orderable = element == int64Type || element == float64Type || element == charType ||
+                             element == boolType || element == stringType;
+            if (!orderable || receiver == "soa_list") {
+                error(at, "Compile Error: " + receiver + ".sort() cannot order " + str(element) +
+                          " elements. Use sort_by(list, key) instead.");
+            }
+        } else known = false;
+    } else if (auto* d = dynamic_cast<DictionaryType*>(object)) {
+        receiver = "dictionary";
+        Type* key = types.intern(*d->keyType);
+        Type* value = types.intern(*d->valueType);
+        if (method == "set") params = {key, value}, result = noneType;
+        else if (method == "remove") params = {key}, result = noneType;
+        else if (method == "has") params = {key}, result = boolType;
+        else if (method == "get") params = {key}, result = types.result(value);
+        else if (method == "size") result = int64Type;
+        else if (method == "getKeys") result = types.list(key);
+        else known = false;
+    } else if (object == stringType || object == fileViewType) {
+        if (method == "size") result = int64Type;
+        else if (method == "at") params = {int64Type}, result = types.result(charType);
+        else if (object == fileViewType && method == "slice") params = {int64Type, int64Type}, result = types.result(fileViewType);
+        else if (object == fileViewType && method == "lines") {
+            // Only meaningful as a for iterable; elsewhere the error stands and the call is untyped
+            if (expr != forIterable) error(at, "Compile Error: lines() can only be used as the iterable of a for loop.");
+            else result = types.list(stringType);
+        } else known = false;
+    } else if (auto* r = dynamic_cast<RoxResultType*>(object); r && method == "getValue") {
+        result = types.intern(*r->valueType);
+    } else if (auto* rec = dynamic_cast<RecordType*>(object)) {
+        // A function stored in a field, called directly
+        Type* field = nullptr;
+        if (auto it = records.find(rec->name); it != records.end()) {
+            for (const auto& f : it->second->fields) {
+                if (f.name.lexeme == method) field = types.intern(*f.type);
+            }
+        }
+        auto* fn = dynamic_cast<FunctionType*>(field);
+        if (fn) {
+            for (const auto& p : fn->paramTypes) params.push_back(types.intern(*p));
+            result = types.intern(*fn->returnType);
+        } else known = false;
+    } else known = false;
+
+    if (!known) {
+        error(at, "Compile Error: Unknown method '" + method + "' on type " + str(object) + ".");
+        return rest();
+    }
+    if (expr->arguments.size() != params.size()) {
+        error(at, "Compile Error: " + receiver + "." + method + "() expects " + std::to_string(params.size()) +
+                  " argument(s) but got " + std::to_string(expr->arguments.size()) + ".");
+    }
+    for (size_t i = 0; i < expr->arguments.size(); ++i) {
+        Type* want = i < params.size() ? params[i] : nullptr;
+        Type* got = checkExpr(expr->arguments[i].get(), want);
+        if (assignable(want, got)) continue;
+        if (receiver == "list" && method == "append") {
+            error(at, "Type Error: List append type mismatch. Expected " + str(want) + " but got " + str(got) + ".");
+        } else if (receiver == "dictionary") {
+            error(at, std::string("Type Error: Dictionary ") + (i == 0 ? "key" : "value") + " type mismatch. Expected " +
+                      str(want) + " but got " + str(got) + ".");
+        } else {
+            error(at, "Type Error: Argument " + std::to_string(i + 1) + " of " + receiver + "." + method + "() expects " +
+                      str(want) + " but got " + str(got) + ".");
+        }
+    }
+    return result;
+}
+
+Type* Sema::checkListLiteral(ListLiteralExpr* expr, Type* expected) {
+    auto* target = dynamic_cast<ListType*>(expected);
+    Type* element = target ? types.intern(*target->elementType) : nullptr;
+    if (expr->elements.empty()) {
+        if (!target) error(0, "Compile Error: Cannot infer the element type of an empty list literal here.");
+        return expected;
+    }
+    Type* first = nullptr;
+    for (const auto& e : expr->elements) {
+        Type* t = checkExpr(e.get(), element);
+        if (!t) continue;
+        if (!first) first = t;
+        else if (t != first) {
+            error(lineOf(e.get()), "Type Error: List elements must all have the same type. Expected " + str(first) +
+                                   " but got " + str(t) + ".");
+        }
+    }
+    if (!first) return nullptr;
+    // The same literal initializes a list[T] or a soa_list[T].
+    if (target && first == element) return expected;
+    return types.list(first);
+}
+
+Type* Sema::checkRecordInit(RecordInitExpr* expr) {
+    const std::string& name = expr->typeName.lexeme;
+    int at = expr->typeName.line;
+    auto it = records.find(name);
+    if (it == records.end()) {
+        error(at, "Compile Error: Unknown type '" + name + "'.");
+        for (const auto& f : expr->fields) checkExpr(f.value.get());
+        return nullptr;
+    }
+    TypeDefStmt* def = it->second;
+
+    std::unordered_set<std::string> seen;
+    for (const auto& fi : expr->fields) {
+        if (!seen.insert(fi.name.lexeme).second) {
+            error(fi.name.line, "Compile Error: Duplicate field '" + fi.name.lexeme + "' in " + name + " initializer.");
+        }
+        Type* want = nullptr;
+        bool found = false;
+        for (const auto& f : def->fields) {
+            if (f.name.lexeme == fi.name.lexeme) {
+                want = types.intern(*f.type);
+                found = true;
+            }
+        }
+        if (!found) error(fi.name.line, "Compile Error: Unknown field '" + fi.name.lexeme + "' in type '" + name + "'.");
+        Type* got = checkExpr(fi.value.get(), want);
+        if (!assignable(want, got)) {
+            error(fi.name.line, "Type Error: Field '" + fi.name.lexeme + "' expects " + str(want) + " but got " + str(got) + ".");
+        }
+    }
+    for (const auto& f : def->fields) {
+        if (!seen.count(f.name.lexeme)) {
+            error(at, "Compile Error: Missing field '" + f.name.lexeme + "' in " + name + " initializer.");
+        }
+    }
+    return types.intern(RecordType(name));
+}
+
+Type* Sema::fieldType(Type* object, const Token& field) {
+    if (!object) return nullptr;
+    auto* record = dynamic_cast<RecordType*>(object);
+    auto it = record ? records.find(record->name) : records.end();
+    if (it == records.end()) {
+        error(field.line, "Compile Error: " + str(object) + " has no field '" + field.lexeme + "'.");
+        return nullptr;
+    }
+    for (const auto& f : it->second->fields) {
+        if (f.name.lexeme == field.lexeme) return types.intern(*f.type);
+    }
+    error(field.line, "Compile Error: Unknown field '" + field.lexeme + "' on type '" + record->name + "'.");
+    return nullptr;
+}
+
+} // namespace rox
@@ -0,0 +1,86 @@
+#ifndef ROX_SEMA_H
+#define ROX_SEMA_H
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include "ast.h"
+
+namespace rox {
+
+// One canonical Type object per distinct type, so annotated types compare by pointer.
+class TypeTable {
+public:
+    Type* intern(const Type& type);
+    Type* list(Type* element);
+    Type* result(Type* value);
+    Type* task(Type* result);
+
+private:
+    std::unordered_map<std::string, std::unique_ptr<Type>> types; // keyed by toString()
+};
+
+// Checks a parsed program before codegen: resolves every name, annotates every Expr
+// with its interned type (Expr::type) and collects all type errors instead of stopping
+// at the first. Flow-sensitive rules (getValue safety, mutation while iterating,
+// parallel loop bodies) stay in codegen, which walks the control flow anyway.
+class Sema {
+public:
+    Sema(const std::vector<std::unique_ptr<Stmt>>& statements);
+    // True if the program is well typed; otherwise see diagnostics().
+    bool check();
+    const std::vector<Diagnostic>& diagnostics() const { return errors; }
+
+private:
+    struct Symbol { Type* type; bool isConst; };
+    using Scope = std::unordered_map<std::string, Symbol>;
+
+    const std::vector<std::unique_ptr<Stmt>>& statements;
+    TypeTable types; // owns every annotation, so Sema must outlive codegen
+    std::vector<Diagnostic> errors;
+    std::vector<Scope> scopes;
+    std::unordered_map<std::string, TypeDefStmt*> records;
+    std::unordered_map<std::string, FunctionStmt*> functions;
+    std::unordered_map<std::string, std::pair<std::vector<Type*>, Type*>> signatures; // monomorphic builtins
+    FunctionStmt* currentFunction = nullptr;
+    Type* returnType = nullptr; // of currentFunction
+    Expr* forIterable = nullptr; // the iterable being checked: the only place range() may appear
+    int loopDepth = 0;
+    int line = 0; // of the statement being checked, for expressions that carry no token
+    Type* int64Type;
+    Type* float64Type;
+    Type* boolType;
+    Type* charType;
+    Type* stringType;
+    Type* noneType;
+    Type* fileViewType;
+
+    void error(int line, const std::string& message);
+    Type* resolve(Type* written, int line);
+    Type* functionType(FunctionStmt* fn);
+    void declare(const Token& name, Type* type, bool isConst);
+    Symbol* lookup(const std::string& name);
+    bool assignable(Type* to, Type* from);
+    bool isBuiltinCall(Expr* callee, const std::string& name);
+
+    void checkStmt(Stmt* stmt);
+    void checkFunction(FunctionStmt* stmt);
+    void checkLet(LetStmt* stmt);
+    void checkFor(ForStmt* stmt);
+    void checkReturn(ReturnStmt* stmt);
+
+    Type* checkExpr(Expr* expr, Type* expected = nullptr);
+    Type* checkVariable(VariableExpr* expr);
+    Type* checkBinary(BinaryExpr* expr);
+    Type* checkCall(CallExpr* expr, Type* expected);
+    Type* checkBuiltin(CallExpr* expr, const std::string& name, Type* expected);
+    Type* checkMethodCall(MethodCallExpr* expr);
+    Type* checkListLiteral(ListLiteralExpr* expr, Type* expected);
+    Type* checkRecordInit(RecordInitExpr* expr);
+    Type* fieldType(Type* object, const Token& field);
+};
+
+} // namespace rox
+
+#endif // ROX_SEMA_H
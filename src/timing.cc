@@ -0,0 +1,85 @@
+#include "timing.h"
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <sys/resource.h>
+
+namespace rox {
+
+PassTimes::Scope::Scope(PassTimes& times, std::string name)
+    : times(times), name(std::move(name)), wall(wallNow()), cpu(cpuNow()) {}
+
+PassTimes::Scope::~Scope() {
+    double wallMs = wallNow() - wall;
+    double cpuMs = cpuNow() - cpu;
+    for (auto& pass : times.passes) {
+        if (pass.name != name) continue;
+        pass.wallMs += wallMs;
+        pass.cpuMs += cpuMs;
+        return;
+    }
+    times.passes.push_back({name, wallMs, cpuMs});
+}
+
+void PassTimes::count(const std::string& name, uint64_t value) {
+    for (auto& counter : counters) {
+        if (counter.first != name) continue;
+        counter.second += value;
+        return;
+    }
+    counters.push_back({name, value});
+}
+
+// Milliseconds since an arbitrary start.
+double PassTimes::wallNow() {
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double, std::milli>(now).count();
+}
+
+// CPU milliseconds used by this process and by its children that have been waited for.
+double PassTimes::cpuNow() {
+    timespec self;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &self);
+    rusage children;
+    getrusage(RUSAGE_CHILDREN, &children);
+    auto ms = [](const timeval& t) { return t.tv_sec * 1e3 + t.tv_usec / 1e3; };
+    return self.tv_sec * 1e3 + self.tv_nsec / 1e6 + ms(children.ru_utime) + ms(children.ru_stime);
+}
+
+std::string PassTimes::text() const {
+    char line[128];
+    std::string result = "===== rox pass timing =====\n";
+    snprintf(line, sizeof line, "%-16s %12s %12s\n", "pass", "wall (ms)", "cpu (ms)");
+    result += line;
+    double wall = 0, cpu = 0;
+    for (const auto& pass : passes) {
+        snprintf(line, sizeof line, "%-16s %12.3f %12.3f\n", pass.name.c_str(), pass.wallMs, pass.cpuMs);
+        result += line;
+        wall += pass.wallMs;
+        cpu += pass.cpuMs;
+    }
+    snprintf(line, sizeof line, "%-16s %12.3f %12.3f\n", "total", wall, cpu);
+    result += line;
+    for (const auto& counter : counters) {
+        snprintf(line, sizeof line, "%-16s %12llu\n", counter.first.c_str(), (unsigned long long)counter.second);
+        result += line;
+    }
+    return result;
+}
+
+std::string PassTimes::json() const {
+    char number[64];
+    std::string result = "{\"passes\":[";
+    for (size_t i = 0; i < passes.size(); ++i) {
+        snprintf(number, sizeof number, "\"wall_ms\":%.3f,\"cpu_ms\":%.3f}", passes[i].wallMs, passes[i].cpuMs);
+        result += (i ? ",{\"name\":\"" : "{\"name\":\"") + passes[i].name + "\"," + number;
+    }
+    result += "],\"counters\":{";
+    for (size_t i = 0; i < counters.size(); ++i) {
+        result += (i ? ",\"" : "\"") + counters[i].first + "\":" + std::to_string(counters[i].second);
+    }
+    result += "}}\n";
+    return result;
+}
+
+} // namespace rox
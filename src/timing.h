@@ -0,0 +1,55 @@
+#ifndef ROX_TIMING_H
+#define ROX_TIMING_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace rox {
+
+// Wall and CPU time per phase of a rox invocation, plus counters, for --time-passes.
+// CPU time covers every thread of rox and the child processes (clang, the program)
+// that finished during the phase.
+class PassTimes {
+public:
+    // Times the phase `name` from construction to destruction; a phase timed again
+    // (e.g. one clang run per unit) adds up.
+    class Scope {
+    public:
+        Scope(PassTimes& times, std::string name);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        PassTimes& times;
+        std::string name;
+        double wall;
+        double cpu;
+    };
+    Scope time(const std::string& name) { return Scope(*this, name); }
+
+    // Adds `value` to the counter `name`.
+    void count(const std::string& name, uint64_t value);
+
+    // A table for people, and one line of JSON for scripts:
+    // {"passes":[{"name":..,"wall_ms":..,"cpu_ms":..},..],"counters":{..}}
+    std::string text() const;
+    std::string json() const;
+
+private:
+    struct Pass {
+        std::string name;
+        double wallMs = 0;
+        double cpuMs = 0;
+    };
+    std::vector<Pass> passes; // in the order they first ran
+    std::vector<std::pair<std::string, uint64_t>> counters;
+
+    static double wallNow();
+    static double cpuNow();
+};
+
+} // namespace rox
+
+#endif // ROX_TIMING_H
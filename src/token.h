@@ -25,11 +25,12 @@ enum class TokenType {
     // Keywords.
     AND, ELSE, FALSE, FUNCTION, IF, CONST, NONE, OR,
     PRINT, RETURN, TRUE, FOR, NOT, READ_LINE,
-    BREAK, CONTINUE, TYPE, DEFAULT,
+    BREAK, CONTINUE, TYPE, DEFAULT, PARALLEL,
 
     // Types
     TYPE_INT64, TYPE_FLOAT64, TYPE_BOOL, TYPE_CHAR, TYPE_STRING, TYPE_LIST, TYPE_DICT,
     TYPE_ROX_RESULT, // New
+    TYPE_FILE_VIEW, TYPE_TASK, TYPE_SOA_LIST,
 
     // End of file.
     END_OF_FILE,
@@ -49,6 +50,12 @@ struct Token {
     // The parser can parse the value from the lexeme.
 };
 
+// An error in the source, as reported by the lexer, parser, Sema or Codegen::check().
+struct Diagnostic {
+    int line; // 0 if unknown
+    std::string message;
+};
+
 } // namespace rox
 
 #endif // ROX_TOKEN_H
@@ -25,11 +25,106 @@ fail_count=0
 
 
 
+# Generating with several codegen threads must give the same C++ as one
+test_jobs() {
+    file=$1
+    name=$(basename "$file" .rox)
+    echo -n "Testing parallel codegen $file... "
+    ./rox generate "$file" --jobs 1 > /dev/null 2>&1
+    serial=$(cat "generated/$name.cc")
+    ./rox generate "$file" --jobs 4 > /dev/null 2>&1
+    if [ -n "$serial" ] && [ "$serial" == "$(cat "generated/$name.cc")" ]; then
+        echo -e "${GREEN}PASSED${NC}"
+    else
+        echo -e "${RED}FAILED (output differs from --jobs 1)${NC}"
+        fail_count=$((fail_count + 1))
+    fi
+}
+
+# A program split into translation units must behave as the single-file build
+test_units() {
+    file=$1
+    name=$(basename "$file" .rox)
+    echo -n "Testing split compilation $file... "
+    ./rox compile "$file" > /dev/null 2>&1
+    single=$(./generated/$name 2>&1)
+    if ./rox compile "$file" --units 3 > /dev/null 2>&1 && [ "$single" == "$(./generated/$name 2>&1)" ]; then
+        echo -e "${GREEN}PASSED${NC}"
+    else
+        echo -e "${RED}FAILED (output differs from the single-file build)${NC}"
+        fail_count=$((fail_count + 1))
+    fi
+}
+
+# An incremental rebuild reuses every function's object, and an edit to one function's
+# body recompiles only that function (offset() in test_parallel_codegen.rox)
+test_incremental() {
+    name=incremental_edit
+    echo -n "Testing incremental compilation... "
+    rm -rf "generated/$name.cache"
+    cp test/test_parallel_codegen.rox "generated/$name.rox"
+    first=$(./rox compile "generated/$name.rox" --incremental 2>&1)
+    again=$(./rox compile "generated/$name.rox" --incremental 2>&1)
+    sed -i 's/return base + x;/return base + x + 1;/' "generated/$name.rox"
+    edited=$(./rox compile "generated/$name.rox" --incremental 2>&1)
+    if echo "$again" | grep -q "Recompiling 0 of" && echo "$edited" | grep -q "Recompiling 1 of" &&
+       [ "$(./generated/$name)" == "$(sed 's/^105$/106/' test/test_parallel_codegen.expected)" ]; then
+        echo -e "${GREEN}PASSED${NC}"
+    else
+        echo -e "${RED}FAILED${NC}"
+        echo "$first"; echo "$again"; echo "$edited"
+        fail_count=$((fail_count + 1))
+    fi
+}
+
+# `rox check` prints each error as file:line: message and exits non-zero; a valid file
+# prints nothing. No C++ is written either way.
+test_check() {
+    file=$1
+    expected=$2
+    name=$(basename "$file" .rox)
+    echo -n "Testing check $file... "
+    rm -f "generated/$name.cc"
+    output=$(./rox check "$file" 2>&1)
+    exit_code=$?
+    if [ -z "$expected" ]; then ok=$([ $exit_code -eq 0 ] && [ -z "$output" ] && echo yes)
+    else ok=$([ $exit_code -ne 0 ] && [[ "$output" == "$expected"* ]] && echo yes); fi
+    if [ "$ok" == "yes" ] && [ ! -f "generated/$name.cc" ]; then
+        echo -e "${GREEN}PASSED${NC}"
+    else
+        echo -e "${RED}FAILED${NC}"
+        echo "$output"
+        fail_count=$((fail_count + 1))
+    fi
+}
+
+# --time-passes=json prints one line of JSON on stderr with every phase of `run` and the counters
+test_time_passes() {
+    echo -n "Testing --time-passes... "
+    report=$(./rox run test/good_test.rox --time-passes=json 2>&1 >/dev/null | tail -1)
+    missing=""
+    for key in read lex parse codegen write compile link run tokens ast_nodes cxx_bytes preamble_bytes; do
+        echo "$report" | grep -q "\"$key\"" || missing="$missing $key"
+    done
+    if [[ "$report" == '{"passes":['* ]] && [ -z "$missing" ]; then
+        echo -e "${GREEN}PASSED${NC}"
+    else
+        echo -e "${RED}FAILED (missing:$missing)${NC}"
+        echo "$report"
+        fail_count=$((fail_count + 1))
+    fi
+}
+
 run_test() {
     file=$1
     echo -n "Testing $file... "
-    # Run the test and capture output/exit code
-    output=$(./rox run "$file" 2>&1)
+    # Run the test and capture output/exit code; test/foo.input, if present, is fed to stdin
+    input="${file%.rox}.input"
+    if [ -f "$input" ]; then
+        output=$(./rox run "$file" < "$input" 2>&1)
+    else
+        output=$(./rox run "$file" 2>&1)
+    fi
     exit_code=$?
 
     if [ $exit_code -eq 0 ]; then
@@ -79,17 +174,47 @@ run_test "test/test_continue.rox"
 run_test "test/test_cpp_collision.rox"
 run_test "test/test_cpp_keywords.rox"
 run_test "test/test_dict.rox"
+run_test "test/test_dict_iteration.rox"
 run_test "test/test_format_not.rox"
 run_test "test/test_format_out.rox"
 run_test "test/test_format.rox"
 run_test "test/test_functions_as_values.rox"
+run_test "test/test_function_clones.rox"
 run_test "test/test_list_set.rox"
+run_test "test/test_small_list.rox"
+run_test "test/test_parallel_codegen.rox"
+test_jobs "test/test_parallel_codegen.rox"
+test_jobs "test/test_function_clones.rox"
+test_jobs "test/test_reductions.rox"
+test_units "test/test_parallel_codegen.rox"
+test_units "test/test_function_clones.rox"
+test_units "test/test_tasks.rox"
+test_units "test/test_small_list.rox"
+test_incremental
+test_check "test/good_test.rox"
+test_time_passes
+test_check "test/test_flow_invalid_1.rox" "test/test_flow_invalid_1.rox:6: Compile Error: getValue(res) is unsafe"
+test_check "test/types_sema_fail.rox" "test/types_sema_fail.rox:7: Type Error"
+test_check "test/test_roxv26_prefix.rox" "test/test_roxv26_prefix.rox:3: Error: Identifier 'roxv26_illegal'"
 run_test "test/test_math.rox"
+run_test "test/test_reductions.rox"
+run_test "test/test_sort.rox"
+run_test "test/test_print_format.rox"
+run_test "test/test_print_flush_on_error.rox"
+run_test "test/test_stdin.rox"
+run_test "test/test_files.rox"
 run_test "test/test_pop.rox"
 run_test "test/test_regression.rox"
 run_test "test/test_result_error.rox"
 run_test "test/test_string.rox"
 run_test "test/test_range.rox"
+run_test "test/test_range_lowering.rox"
+run_test "test/test_parallel_for.rox"
+run_test "test/test_parallel_builtins.rox"
+run_test "test/test_tasks.rox"
+run_test "test/test_arena.rox"
+run_test "test/test_soa_list.rox"
+run_test "test/test_record_layout.rox"
 run_test "test/test_for_in_list.rox"
 run_test "test/types_record_basic.rox"
 run_test "test/types_composition_nested.rox"
@@ -102,22 +227,48 @@ run_test "test/types_default_nested.rox"
 run_test "test/two_sum.rox"
 run_test "test/valid_parentheses.rox"
 run_test "test/test_flow_sensitive_return.rox"
+run_test "test/test_bounds_elim.rox"
+run_test "test/test_const_fold.rox"
+run_test "test/test_div_nonzero.rox"
 
 # run tests that should fail
 test_fail "test/test_roxv26_prefix.rox"
 test_fail "test/test_string_fail.rox"
 test_fail "test/test_flow_invalid_1.rox" "getValue(res) is unsafe"
 test_fail "test/test_flow_invalid_2.rox" "getValue(res) is unsafe"
+test_fail "test/test_div_unproven_fail.rox" "getValue(r) is unsafe"
 test_fail "test/test_dict_fail.rox" "Type Error: Dictionary value type mismatch"
 test_fail "test/test_list_append_fail.rox" "Type Error: List append type mismatch"
 test_fail "test/test_range_fail.rox" "range() step cannot be 0"
 test_fail "test/test_iterate_mutate_fail.rox" "Cannot mutate"
+test_fail "test/test_dict_iterate_mutate_fail.rox" "Cannot mutate"
+test_fail "test/test_entry_loop_list_fail.rox" "requires a dictionary"
+test_fail "test/test_parallel_write_fail.rox" "cannot write outer variable"
+test_fail "test/test_parallel_io_fail.rox" "prints or reads input"
+test_fail "test/test_parallel_break_fail.rox" "cannot break out of the loop"
+test_fail "test/test_parallel_map_io_fail.rox" "prints or reads input"
+test_fail "test/test_parallel_map_global_fail.rox" "'bump' writes global variables"
+test_fail "test/test_parallel_map_value_fail.rox" "pass a function by name"
+test_fail "test/test_parallel_shadow_fail.rox" "cannot write outer variable 'total'"
+test_fail "test/test_parallel_global_fail.rox" "'add' writes global variables"
+test_fail "test/test_parallel_call_value_fail.rox" "cannot call a function value"
+test_fail "test/test_spawn_io_fail.rox" "prints or reads input"
+test_fail "test/test_spawn_global_fail.rox" "'bump' writes global variables"
+test_fail "test/test_spawn_value_fail.rox" "pass a function by name"
+test_fail "test/test_soa_list_fail.rox" "soa_list elements must be a record type"
+test_fail "test/test_sort_record_fail.rox" "Use sort_by(list, key) instead"
+test_fail "test/test_parallel_reduce_type_fail.rox" "Argument 3 of 'parallel_reduce' expects function(int64, int64) -> int64"
+test_fail "test/test_print_type_fail.rox" "Argument 2 of 'print' has type list\[int64\], which cannot be printed"
+test_fail "test/test_dict_key_fail.rox" "Dictionary keys must be int64, float64, bool, char or string, not list\[int64\]"
 test_fail "test/types_missing_field_fail.rox" "Missing field"
 test_fail "test/types_unknown_field_fail.rox" "Unknown field"
 test_fail "test/types_duplicate_field_fail.rox" "Duplicate field"
 test_fail "test/types_field_type_mismatch_fail.rox" "Type Error"
 test_fail "test/types_unknown_field_access_fail.rox" "Unknown field"
 test_fail "test/types_uninitialized_fail.rox" "Uninitialized record"
+# Semantic analysis reports every error, not just the first
+test_fail "test/types_sema_fail.rox" "Cannot initialize 'count'"
+test_fail "test/types_sema_fail.rox" "Undefined variable 'total'"
 
 
 echo "--------------------------------"